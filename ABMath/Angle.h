@@ -1,5 +1,11 @@
 #pragma once
 
+#include <type_traits>
+
+#include "Float.h"
+
+// Angles compare with an epsilon tolerance by default. Defining ABMATH_STRICT_ANGLE_COMPARISON for the whole
+// build makes the comparison operators exact float comparisons, which are cheaper in hot loops.
 namespace ABMath
 {
 	class Angle
@@ -10,40 +16,73 @@ namespace ABMath
 		constexpr static float TWO_PI = PI * 2.f;
 
 		template<class T>
-		static Angle CreateWithDegrees(const T& deg)
+		static constexpr Angle CreateWithDegrees(const T& deg)
 		{
 			return Angle(DegreesToRadians(deg));
 		}
 
-		static Angle CreateWithRadians(const float rad);
+		static constexpr Angle CreateWithRadians(const float rad)
+		{
+			return Angle(rad);
+		}
 
-		static Angle CreatePi();
+		static constexpr Angle CreatePi()
+		{
+			return Angle(PI);
+		}
 
-		static Angle CreateTwoPi();
+		static constexpr Angle CreateTwoPi()
+		{
+			return Angle(TWO_PI);
+		}
 
-		static Angle CreatePiOverTwo();
+		static constexpr Angle CreatePiOverTwo()
+		{
+			return Angle(PI_OVER_TWO);
+		}
 
-		static Angle Zero();
+		static constexpr Angle Zero()
+		{
+			return Angle(0.f);
+		}
 
-		float GetRadians() const;
+		constexpr float GetRadians() const
+		{
+			return _radians;
+		}
 
-		Angle operator-() const;
+		constexpr Angle operator-() const
+		{
+			return Angle(-_radians);
+		}
 
-		Angle& operator+=(const Angle& other);
+		constexpr Angle& operator+=(const Angle& other)
+		{
+			_radians += other._radians;
+			return *this;
+		}
 
-		Angle& operator-=(const Angle& other);
+		constexpr Angle& operator-=(const Angle& other)
+		{
+			_radians -= other._radians;
+			return *this;
+		}
 
-		Angle& operator/=(const Angle& other);
+		constexpr Angle& operator/=(const Angle& other)
+		{
+			_radians /= other._radians;
+			return *this;
+		}
 
 		template<class T>
-		Angle& operator*=(const T& factor)
+		constexpr Angle& operator*=(const T& factor)
 		{
 			_radians *= factor;
 			return *this;
 		}
 
 		template<class T>
-		Angle& operator/=(const T& factor)
+		constexpr Angle& operator/=(const T& factor)
 		{
 			_radians /= factor;
 			return *this;
@@ -57,37 +96,78 @@ namespace ABMath
 		}
 
 		Angle() = default;
-		explicit Angle(const float radians);
+		constexpr explicit Angle(const float radians)
+			: _radians(radians)
+		{}
 
 	private:
 		float _radians;
 	};
 
+	static_assert(sizeof(Angle) == sizeof(float), "Angle must stay a bare float");
+	static_assert(std::is_trivially_copyable_v<Angle>, "Angle must stay trivially copyable");
+
 	template<class T>
-	T GetDegrees(const Angle& angle)
+	constexpr T GetDegrees(const Angle& angle)
 	{
-		return static_cast<T>(angle.GetRadians() * 180.f / Angle::CreatePi().GetRadians());
+		return static_cast<T>(angle.GetRadians() * 180.f / Angle::PI);
 	}
 
-	bool operator<(const Angle& left, const Angle& right);
+	constexpr bool operator==(const Angle& left, const Angle& right)
+	{
+#if defined(ABMATH_STRICT_ANGLE_COMPARISON)
+		return left.GetRadians() == right.GetRadians();
+#else
+		return AreFloatsEqual(left.GetRadians(), right.GetRadians());
+#endif
+	}
 
-	bool operator>(const Angle& left, const Angle& right);
+	constexpr bool operator!=(const Angle& left, const Angle& right)
+	{
+		return !(left == right);
+	}
 
-	bool operator==(const Angle& left, const Angle& right);
+	constexpr bool operator<(const Angle& left, const Angle& right)
+	{
+		return left.GetRadians() < right.GetRadians() && left != right;
+	}
 
-	bool operator!=(const Angle& left, const Angle& right);
+	constexpr bool operator>(const Angle& left, const Angle& right)
+	{
+		return right < left;
+	}
+
+	constexpr bool operator<=(const Angle& left, const Angle& right)
+	{
+		return left < right || left == right;
+	}
 
-	bool operator<=(const Angle& left, const Angle& right);
-	bool operator>=(const Angle& left, const Angle& right);
+	constexpr bool operator>=(const Angle& left, const Angle& right)
+	{
+		return left > right || left == right;
+	}
 
-	Angle operator+(const Angle& left, const Angle& right);
+	constexpr Angle operator+(const Angle& left, const Angle& right)
+	{
+		Angle result = left;
+		result += right;
+		return result;
+	}
 
-	Angle operator-(const Angle& left, const Angle& right);
+	constexpr Angle operator-(const Angle& left, const Angle& right)
+	{
+		return left + (-right);
+	}
 
-	Angle operator/(const Angle& left, const Angle& right);
+	constexpr Angle operator/(const Angle& left, const Angle& right)
+	{
+		Angle result = left;
+		result /= right;
+		return result;
+	}
 
 	template<class T>
-	Angle operator*(const Angle& angle, const T& factor)
+	constexpr Angle operator*(const Angle& angle, const T& factor)
 	{
 		Angle result = angle;
 		result *= factor;
@@ -95,18 +175,26 @@ namespace ABMath
 	}
 
 	template<class T>
-	Angle operator*(const T& factor, const Angle& angle)
+	constexpr Angle operator*(const T& factor, const Angle& angle)
 	{
 		return angle * factor;
 	}
 
 	template<class T>
-	Angle operator/(const Angle& angle, const T& factor)
+	constexpr Angle operator/(const Angle& angle, const T& factor)
 	{
 		Angle result = angle;
 		result /= factor;
 		return result;
 	}
 
-	Angle GetAbsolute(const Angle& angle);
-}
\ No newline at end of file
+	constexpr Angle GetAbsolute(const Angle& angle)
+	{
+		if (angle > Angle::Zero())
+		{
+			return angle;
+		}
+
+		return -angle;
+	}
+}
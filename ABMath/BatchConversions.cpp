@@ -0,0 +1,970 @@
+#include "BatchConversions.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <limits>
+
+#include "Float.h"
+#include "Parallel.h"
+#include "Simd.h"
+
+namespace ABMath
+{
+	namespace
+	{
+		bool IsPitchInGimbalLock(const float pitch)
+		{
+			return AreFloatsEqual(std::fabs(pitch), Angle::PI_OVER_TWO);
+		}
+
+		// Angles go through the batched SinCos and Atan2 this many at a time, in buffers on the stack.
+		constexpr size_t TRIG_BLOCK_SIZE = 256;
+
+		void HalveAngles(const float* radians, const size_t count, float* outRadians)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				outRadians[i] = radians[i] / 2.f;
+			}
+		}
+
+		// Lane-wise Angle comparisons with the same tolerance as the Angle operators: left > right holds once the
+		// difference reaches the epsilon, left >= right once it is past minus the epsilon.
+		Simd::Mask4 IsAngleGreater(const Simd::Float4 left, const Simd::Float4 right)
+		{
+#if defined(ABMATH_STRICT_ANGLE_COMPARISON)
+			return Simd::Greater(left, right);
+#else
+			return Simd::GreaterOrEqual(Simd::Subtract(left, right), Simd::Splat(std::numeric_limits<float>::epsilon()));
+#endif
+		}
+
+		Simd::Mask4 IsAngleGreaterOrEqual(const Simd::Float4 left, const Simd::Float4 right)
+		{
+#if defined(ABMATH_STRICT_ANGLE_COMPARISON)
+			return Simd::GreaterOrEqual(left, right);
+#else
+			return Simd::Greater(Simd::Subtract(left, right), Simd::Splat(-std::numeric_limits<float>::epsilon()));
+#endif
+		}
+
+		// Four-lane IsInGimbalLockState.
+		Simd::Mask4 IsInGimbalLockState4(const Simd::Float4 pitches)
+		{
+			using namespace Simd;
+
+			const Float4 difference = Subtract(Absolute(pitches), Splat(Angle::PI_OVER_TWO));
+			return Greater(Splat(std::numeric_limits<float>::epsilon()), Absolute(difference));
+		}
+
+		// The four-lane kernels below repeat the float operations of the scalar Detail kernels in the same order and
+		// replace every branch with a select, so each lane ends up bit-identical to the single-object ToCanonicalForm.
+		Simd::Float4 SubtractWholeTurns4(const Simd::Float4 radians)
+		{
+			using namespace Simd;
+
+			const Float4 twoPi = Splat(Angle::TWO_PI);
+			return Subtract(radians, Multiply(Floor(Divide(radians, twoPi)), twoPi));
+		}
+
+		// Four-lane Detail::WrapPolarAngle.
+		Simd::Float4 WrapPolarAngle4(const Simd::Float4 angles)
+		{
+			using namespace Simd;
+
+			const Float4 pi = Splat(Angle::PI);
+			const Float4 wrapped = Subtract(SubtractWholeTurns4(Add(angles, pi)), pi);
+
+			return Select(IsAngleGreater(Absolute(angles), pi), wrapped, angles);
+		}
+
+		// Four-lane Detail::FoldVerticalAngle.
+		Simd::Float4 FoldVerticalAngle4(const Simd::Float4 angles, Simd::Mask4& outFlipsHorizontal)
+		{
+			using namespace Simd;
+
+			const Float4 pi = Splat(Angle::PI);
+			const Float4 piOverTwo = Splat(Angle::PI_OVER_TWO);
+
+			const Float4 turned = SubtractWholeTurns4(Add(angles, piOverTwo));
+
+			const Mask4 isPastPi = IsAngleGreater(turned, pi);
+			const Float4 folded = Subtract(Select(isPastPi, Subtract(Splat(3.f * Angle::PI_OVER_TWO), turned), Subtract(turned, piOverTwo)), piOverTwo);
+
+			const Mask4 isOutOfRange = IsAngleGreater(Absolute(angles), piOverTwo);
+			outFlipsHorizontal = And(isOutOfRange, isPastPi);
+			return Select(isOutOfRange, folded, angles);
+		}
+
+		// Four-lane Detail::WrapEulerAngle.
+		Simd::Float4 WrapEulerAngle4(const Simd::Float4 angles)
+		{
+			using namespace Simd;
+
+			const Float4 pi = Splat(Angle::PI);
+			const Float4 minusPi = Splat(-Angle::PI);
+
+			Float4 wrapped = Subtract(SubtractWholeTurns4(Add(angles, pi)), pi);
+			wrapped = Select(IsAngleGreaterOrEqual(minusPi, wrapped), Add(wrapped, Splat(Angle::TWO_PI)), wrapped);
+
+			const Mask4 isInPiRange = And(IsAngleGreater(angles, minusPi), IsAngleGreaterOrEqual(pi, angles));
+			return Select(isInPiRange, angles, wrapped);
+		}
+
+		// Four-lane Detail::CanonicalizePolarVector2.
+		void CanonicalizePolarVector24(Simd::Float4& lengths, Simd::Float4& angles)
+		{
+			using namespace Simd;
+
+			const Float4 zero = Splat(0.f);
+
+			const Mask4 isZero = Equal(lengths, zero);
+			const Mask4 isNegative = Greater(zero, lengths);
+
+			const Float4 turned = Select(isNegative, Add(angles, Splat(Angle::PI)), angles);
+
+			lengths = Select(isNegative, Negate(lengths), lengths);
+			angles = Select(isZero, zero, WrapPolarAngle4(turned));
+		}
+
+		// Four-lane Detail::CanonicalizeClassicPolarVector3 and Detail::CanonicalizePolarVector3, which only differ in
+		// when the horizontal angle is dropped.
+		template<bool IS_CLASSIC>
+		void CanonicalizePolarVector34(Simd::Float4& lengths, Simd::Float4& horAngles, Simd::Float4& vertAngles)
+		{
+			using namespace Simd;
+
+			const Float4 zero = Splat(0.f);
+			const Float4 pi = Splat(Angle::PI);
+
+			const Mask4 isZero = Equal(lengths, zero);
+			const Mask4 isNegative = Greater(zero, lengths);
+
+			Float4 turnedHorAngles = Select(isNegative, Add(horAngles, pi), horAngles);
+			auto flipsHorizontal = Mask4();
+			const Float4 foldedVertAngles = FoldVerticalAngle4(Select(isNegative, Negate(vertAngles), vertAngles), flipsHorizontal);
+			turnedHorAngles = Select(flipsHorizontal, Add(turnedHorAngles, pi), turnedHorAngles);
+
+			const Mask4 dropsHorAngle = IS_CLASSIC
+				? GreaterOrEqual(Splat(0.0001f), Absolute(foldedVertAngles))
+				: IsAngleGreaterOrEqual(Absolute(foldedVertAngles), Splat(Angle::PI_OVER_TWO * 0.9999f));
+			const Float4 wrappedHorAngles = Select(dropsHorAngle, zero, WrapPolarAngle4(turnedHorAngles));
+
+			lengths = Select(isNegative, Negate(lengths), lengths);
+			horAngles = Select(isZero, zero, wrappedHorAngles);
+			vertAngles = Select(isZero, zero, foldedVertAngles);
+		}
+
+		// Four-lane Detail::CanonicalizeEulerAngles.
+		void CanonicalizeEulerAngles4(Simd::Float4& headings, Simd::Float4& pitches, Simd::Float4& banks)
+		{
+			using namespace Simd;
+
+			const Float4 zero = Splat(0.f);
+			const Float4 pi = Splat(Angle::PI);
+			const Float4 minusPi = Splat(-Angle::PI);
+			const Float4 piOverTwo = Splat(Angle::PI_OVER_TWO);
+
+			const Float4 inputBanks = Select(IsInGimbalLockState4(pitches), zero, banks);
+
+			const Float4 wrappedPitches = WrapEulerAngle4(pitches);
+			const Mask4 isAbove = IsAngleGreater(wrappedPitches, piOverTwo);
+			const Mask4 isBelow = IsAngleGreater(Splat(-Angle::PI_OVER_TWO), wrappedPitches);
+			const Mask4 isFlipped = Or(isAbove, isBelow);
+			const Float4 foldedPitches = Select(isAbove, Subtract(pi, wrappedPitches), Select(isBelow, Subtract(minusPi, wrappedPitches), wrappedPitches));
+
+			const Float4 turnedHeadings = Select(isFlipped, Add(headings, pi), headings);
+			const Float4 turnedBanks = Select(isFlipped, Add(inputBanks, pi), inputBanks);
+
+			const Mask4 isLocked = IsInGimbalLockState4(foldedPitches);
+
+			headings = WrapEulerAngle4(Select(isLocked, Add(turnedHeadings, turnedBanks), turnedHeadings));
+			pitches = foldedPitches;
+			banks = Select(isLocked, zero, WrapEulerAngle4(turnedBanks));
+		}
+	}
+
+	void QuaternionToEulerAngles(const QuaternionArray& quaternions, EulerAnglesArray& outEulerAngles)
+	{
+		const size_t count = quaternions.GetSize();
+		outEulerAngles.Resize(count);
+
+		const float* ws = quaternions.GetLane(0);
+		const float* xs = quaternions.GetLane(1);
+		const float* ys = quaternions.GetLane(2);
+		const float* zs = quaternions.GetLane(3);
+		float* headings = outEulerAngles.GetLane(0);
+		float* pitches = outEulerAngles.GetLane(1);
+		float* banks = outEulerAngles.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float headingYs[TRIG_BLOCK_SIZE];
+			float headingXs[TRIG_BLOCK_SIZE];
+			float bankYs[TRIG_BLOCK_SIZE];
+			float bankXs[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float w = ws[i];
+					const float x = xs[i];
+					const float y = ys[i];
+					const float z = zs[i];
+
+					// The sine is clamped, so inputs the scalar version turns into NaN come out at -90 degrees instead.
+					const float pitchSin = -2.f * (y*z - w*x);
+					const bool isLocked = IsFloatEqualOrLarger(pitchSin, 1.f);
+					pitches[i] = isLocked ? Angle::PI_OVER_TWO : std::asin(std::max(pitchSin, -1.f));
+
+					headingYs[j] = isLocked ? (-x*z + w*y) : (x*z + w*y);
+					headingXs[j] = isLocked ? (0.5f - y*y - z*z) : (0.5f - x*x - y*y);
+					bankYs[j] = x*y + w*z;
+					bankXs[j] = 0.5f - x*x - z*z;
+				}
+
+				Atan2(headingYs, headingXs, blockSize, headings + block);
+				Atan2(bankYs, bankXs, blockSize, banks + block);
+
+				for (size_t i = block; i < block + blockSize; ++i)
+				{
+					banks[i] = IsPitchInGimbalLock(pitches[i]) ? 0.f : banks[i];
+				}
+			}
+		});
+	}
+
+	void QuaternionToMatrix(const QuaternionArray& quaternions, Matrix3Array& outMatrices)
+	{
+		const size_t count = quaternions.GetSize();
+		outMatrices.Resize(count);
+
+		const float* ws = quaternions.GetLane(0);
+		const float* xs = quaternions.GetLane(1);
+		const float* ys = quaternions.GetLane(2);
+		const float* zs = quaternions.GetLane(3);
+		float* m[9];
+		for (size_t lane = 0; lane < 9; ++lane)
+		{
+			m[lane] = outMatrices.GetLane(lane);
+		}
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const float w = ws[i];
+				const float x = xs[i];
+				const float y = ys[i];
+				const float z = zs[i];
+
+				m[0][i] = 1 - 2.f*(y*y) - 2.f*(z*z);
+				m[1][i] = 2.f*(x*y) + 2.f*(w*z);
+				m[2][i] = 2.f*(x*z) - 2.f*(w*y);
+
+				m[3][i] = 2.f*(x*y) - 2.f*(w*z);
+				m[4][i] = 1 - 2.f*(x*x) - 2.f*(z*z);
+				m[5][i] = 2.f*(y*z) + 2.f*(w*x);
+
+				m[6][i] = 2.f*(x*z) + 2.f*(w*y);
+				m[7][i] = 2.f*(y*z) - 2.f*(w*x);
+				m[8][i] = 1 - 2.f*(x*x) - 2.f*(y*y);
+			}
+		});
+	}
+
+	void MatrixToEulerAngles(const Matrix3Array& matrices, EulerAnglesArray& outEulerAngles)
+	{
+		const size_t count = matrices.GetSize();
+		outEulerAngles.Resize(count);
+
+		const float* m[9];
+		for (size_t lane = 0; lane < 9; ++lane)
+		{
+			m[lane] = matrices.GetLane(lane);
+		}
+		float* headings = outEulerAngles.GetLane(0);
+		float* pitches = outEulerAngles.GetLane(1);
+		float* banks = outEulerAngles.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float headingYs[TRIG_BLOCK_SIZE];
+			float headingXs[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float sinOfPitch = -m[7][i];
+					const float clampedPitch = std::asin(std::min(std::max(sinOfPitch, -1.f), 1.f));
+					const float pitch = (sinOfPitch <= -1.f) ? -Angle::PI_OVER_TWO : ((sinOfPitch >= 1.f) ? Angle::PI_OVER_TWO : clampedPitch);
+					pitches[i] = pitch;
+
+					const bool isLocked = std::fabs(pitch) == Angle::PI_OVER_TWO;
+					headingYs[j] = isLocked ? -m[2][i] : m[6][i];
+					headingXs[j] = isLocked ? m[0][i] : m[8][i];
+				}
+
+				Atan2(headingYs, headingXs, blockSize, headings + block);
+				Atan2(m[1] + block, m[4] + block, blockSize, banks + block);
+
+				for (size_t i = block; i < block + blockSize; ++i)
+				{
+					banks[i] = IsPitchInGimbalLock(pitches[i]) ? 0.f : banks[i];
+				}
+			}
+		});
+	}
+
+	void MatrixToQuaternion(const Matrix3Array& matrices, QuaternionArray& outQuaternions)
+	{
+		const size_t count = matrices.GetSize();
+		outQuaternions.Resize(count);
+
+		const float* m[9];
+		for (size_t lane = 0; lane < 9; ++lane)
+		{
+			m[lane] = matrices.GetLane(lane);
+		}
+		float* ws = outQuaternions.GetLane(0);
+		float* xs = outQuaternions.GetLane(1);
+		float* ys = outQuaternions.GetLane(2);
+		float* zs = outQuaternions.GetLane(3);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				const float m00 = m[0][i];
+				const float m11 = m[4][i];
+				const float m22 = m[8][i];
+
+				const float fourW2 = 1.f + m00 + m11 + m22;
+				const float fourX2 = 1.f + m00 - m11 - m22;
+				const float fourY2 = 1.f - m00 + m11 - m22;
+				const float fourZ2 = 1.f - m00 - m11 + m22;
+
+				const float fourWX = m[5][i] - m[7][i];
+				const float fourWY = m[6][i] - m[2][i];
+				const float fourWZ = m[1][i] - m[3][i];
+				const float fourXY = m[1][i] + m[3][i];
+				const float fourXZ = m[6][i] + m[2][i];
+				const float fourYZ = m[5][i] + m[7][i];
+
+				// Same case order as the scalar version, resolved with selects instead of branches.
+				const bool isW = fourW2 >= fourX2 && fourW2 >= fourY2 && fourW2 >= fourZ2;
+				const bool isX = !isW && fourX2 >= fourY2 && fourX2 >= fourZ2;
+				const bool isY = !isW && !isX && fourY2 >= fourZ2;
+
+				const float largest = isW ? fourW2 : (isX ? fourX2 : (isY ? fourY2 : fourZ2));
+				const float w = isW ? fourW2 : (isX ? fourWX : (isY ? fourWY : fourWZ));
+				const float x = isW ? fourWX : (isX ? fourX2 : (isY ? fourXY : fourXZ));
+				const float y = isW ? fourWY : (isX ? fourXY : (isY ? fourY2 : fourYZ));
+				const float z = isW ? fourWZ : (isX ? fourXZ : (isY ? fourYZ : fourZ2));
+
+				const float scale = 0.5f / std::sqrt(largest);
+				ws[i] = w * scale;
+				xs[i] = x * scale;
+				ys[i] = y * scale;
+				zs[i] = z * scale;
+			}
+		});
+	}
+
+	void EulerAnglesToQuaternion(const EulerAnglesArray& eulerAngles, QuaternionArray& outQuaternions)
+	{
+		const size_t count = eulerAngles.GetSize();
+		outQuaternions.Resize(count);
+
+		const float* headings = eulerAngles.GetLane(0);
+		const float* pitches = eulerAngles.GetLane(1);
+		const float* banks = eulerAngles.GetLane(2);
+		float* ws = outQuaternions.GetLane(0);
+		float* xs = outQuaternions.GetLane(1);
+		float* ys = outQuaternions.GetLane(2);
+		float* zs = outQuaternions.GetLane(3);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float halfAngles[TRIG_BLOCK_SIZE];
+			float headingSines[TRIG_BLOCK_SIZE];
+			float headingCosines[TRIG_BLOCK_SIZE];
+			float pitchSines[TRIG_BLOCK_SIZE];
+			float pitchCosines[TRIG_BLOCK_SIZE];
+			float bankSines[TRIG_BLOCK_SIZE];
+			float bankCosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+
+				HalveAngles(headings + block, blockSize, halfAngles);
+				SinCos(halfAngles, blockSize, headingSines, headingCosines);
+				HalveAngles(pitches + block, blockSize, halfAngles);
+				SinCos(halfAngles, blockSize, pitchSines, pitchCosines);
+				HalveAngles(banks + block, blockSize, halfAngles);
+				SinCos(halfAngles, blockSize, bankSines, bankCosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float ch = headingCosines[j];
+					const float sh = headingSines[j];
+					const float cp = pitchCosines[j];
+					const float sp = pitchSines[j];
+					const float cb = bankCosines[j];
+					const float sb = bankSines[j];
+
+					ws[i] = ch*cp*cb + sh*sp*sb;
+					xs[i] = ch*sp*cb + sh*cp*sb;
+					ys[i] = sh*cp*cb - ch*sp*sb;
+					zs[i] = ch*cp*sb - sh*sp*cb;
+				}
+			}
+		});
+	}
+
+	void CreateRotation(const EulerAnglesArray& eulerAngles, Matrix3Array& outMatrices)
+	{
+		const size_t count = eulerAngles.GetSize();
+		outMatrices.Resize(count);
+
+		const float* headings = eulerAngles.GetLane(0);
+		const float* pitches = eulerAngles.GetLane(1);
+		const float* banks = eulerAngles.GetLane(2);
+		float* m[9];
+		for (size_t lane = 0; lane < 9; ++lane)
+		{
+			m[lane] = outMatrices.GetLane(lane);
+		}
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float headingSines[TRIG_BLOCK_SIZE];
+			float headingCosines[TRIG_BLOCK_SIZE];
+			float pitchSines[TRIG_BLOCK_SIZE];
+			float pitchCosines[TRIG_BLOCK_SIZE];
+			float bankSines[TRIG_BLOCK_SIZE];
+			float bankCosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				SinCos(headings + block, blockSize, headingSines, headingCosines);
+				SinCos(pitches + block, blockSize, pitchSines, pitchCosines);
+				SinCos(banks + block, blockSize, bankSines, bankCosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float ch = headingCosines[j];
+					const float sh = headingSines[j];
+					const float cp = pitchCosines[j];
+					const float sp = pitchSines[j];
+					const float cb = bankCosines[j];
+					const float sb = bankSines[j];
+
+					m[0][i] = ch*cb + sh*sp*sb;
+					m[1][i] = sb*cp;
+					m[2][i] = -sh*cb + ch*sp*sb;
+					m[3][i] = -ch*sb + sh*sp*cb;
+					m[4][i] = cb*cp;
+					m[5][i] = sb*sh + ch*sp*cb;
+					m[6][i] = sh*cp;
+					m[7][i] = -sp;
+					m[8][i] = ch*cp;
+				}
+			}
+		});
+	}
+
+	void AxisAngleToQuaternion(const FVectorArray3& axes, const std::vector<float>& radians, QuaternionArray& outQuaternions)
+	{
+		const size_t count = axes.GetSize();
+		outQuaternions.Resize(count);
+
+		const float* axisXs = axes.GetLane(0);
+		const float* axisYs = axes.GetLane(1);
+		const float* axisZs = axes.GetLane(2);
+		const float* angles = radians.data();
+		float* ws = outQuaternions.GetLane(0);
+		float* xs = outQuaternions.GetLane(1);
+		float* ys = outQuaternions.GetLane(2);
+		float* zs = outQuaternions.GetLane(3);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float halfAngles[TRIG_BLOCK_SIZE];
+			float sines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+
+				HalveAngles(angles + block, blockSize, halfAngles);
+				SinCos(halfAngles, blockSize, sines, ws + block);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float axisX = axisXs[i];
+					const float axisY = axisYs[i];
+					const float axisZ = axisZs[i];
+					const float scale = 1.f / std::sqrt(axisX * axisX + axisY * axisY + axisZ * axisZ);
+
+					xs[i] = (axisX * scale) * sines[j];
+					ys[i] = (axisY * scale) * sines[j];
+					zs[i] = (axisZ * scale) * sines[j];
+				}
+			}
+		});
+	}
+
+	void PolarVectorToVector(const PolarVectorArray2& polarVectors, FVectorArray2& outVectors)
+	{
+		const size_t count = polarVectors.GetSize();
+		outVectors.Resize(count);
+
+		const float* lengths = polarVectors.GetLane(0);
+		const float* angles = polarVectors.GetLane(1);
+		float* xs = outVectors.GetLane(0);
+		float* ys = outVectors.GetLane(1);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float sines[TRIG_BLOCK_SIZE];
+			float cosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				SinCos(angles + block, blockSize, sines, cosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					xs[i] = lengths[i] * cosines[j];
+					ys[i] = lengths[i] * sines[j];
+				}
+			}
+		});
+	}
+
+	void PolarVectorToVector(const PolarCylindricalVectorArray3& polarVectors, FVectorArray3& outVectors)
+	{
+		const size_t count = polarVectors.GetSize();
+		outVectors.Resize(count);
+
+		const float* lengths = polarVectors.GetLane(0);
+		const float* angles = polarVectors.GetLane(1);
+		const float* heights = polarVectors.GetLane(2);
+		float* xs = outVectors.GetLane(0);
+		float* ys = outVectors.GetLane(1);
+		float* zs = outVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float sines[TRIG_BLOCK_SIZE];
+			float cosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				SinCos(angles + block, blockSize, sines, cosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					xs[i] = lengths[i] * cosines[j];
+					ys[i] = lengths[i] * sines[j];
+					zs[i] = heights[i];
+				}
+			}
+		});
+	}
+
+	void PolarVectorToVector(const ClassicPolarVectorArray3& polarVectors, FVectorArray3& outVectors)
+	{
+		const size_t count = polarVectors.GetSize();
+		outVectors.Resize(count);
+
+		const float* lengths = polarVectors.GetLane(0);
+		const float* horAngles = polarVectors.GetLane(1);
+		const float* vertAngles = polarVectors.GetLane(2);
+		float* xs = outVectors.GetLane(0);
+		float* ys = outVectors.GetLane(1);
+		float* zs = outVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float horSines[TRIG_BLOCK_SIZE];
+			float horCosines[TRIG_BLOCK_SIZE];
+			float vertSines[TRIG_BLOCK_SIZE];
+			float vertCosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				SinCos(horAngles + block, blockSize, horSines, horCosines);
+				SinCos(vertAngles + block, blockSize, vertSines, vertCosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					xs[i] = lengths[i] * vertSines[j] * horCosines[j];
+					ys[i] = lengths[i] * vertSines[j] * horSines[j];
+					zs[i] = lengths[i] * vertCosines[j];
+				}
+			}
+		});
+	}
+
+	void PolarVectorToVector(const PolarVectorArray3& polarVectors, FVectorArray3& outVectors)
+	{
+		const size_t count = polarVectors.GetSize();
+		outVectors.Resize(count);
+
+		const float* lengths = polarVectors.GetLane(0);
+		const float* headings = polarVectors.GetLane(1);
+		const float* pitches = polarVectors.GetLane(2);
+		float* xs = outVectors.GetLane(0);
+		float* ys = outVectors.GetLane(1);
+		float* zs = outVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float headingSines[TRIG_BLOCK_SIZE];
+			float headingCosines[TRIG_BLOCK_SIZE];
+			float pitchSines[TRIG_BLOCK_SIZE];
+			float pitchCosines[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				SinCos(headings + block, blockSize, headingSines, headingCosines);
+				SinCos(pitches + block, blockSize, pitchSines, pitchCosines);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					xs[i] = lengths[i] * pitchCosines[j] * headingSines[j];
+					ys[i] = -lengths[i] * pitchSines[j];
+					zs[i] = lengths[i] * pitchCosines[j] * headingCosines[j];
+				}
+			}
+		});
+	}
+
+	void VectorToPolarVector(const FVectorArray2& vectors, PolarVectorArray2& outPolarVectors)
+	{
+		const size_t count = vectors.GetSize();
+		outPolarVectors.Resize(count);
+
+		const float* xs = vectors.GetLane(0);
+		const float* ys = vectors.GetLane(1);
+		float* lengths = outPolarVectors.GetLane(0);
+		float* angles = outPolarVectors.GetLane(1);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				Atan2(ys + block, xs + block, blockSize, angles + block);
+
+				for (size_t i = block; i < block + blockSize; ++i)
+				{
+					lengths[i] = std::hypot(xs[i], ys[i]);
+				}
+			}
+		});
+	}
+
+	void VectorToPolarCylindricalVector(const FVectorArray3& vectors, PolarCylindricalVectorArray3& outPolarVectors)
+	{
+		const size_t count = vectors.GetSize();
+		outPolarVectors.Resize(count);
+
+		const float* xs = vectors.GetLane(0);
+		const float* ys = vectors.GetLane(1);
+		const float* zs = vectors.GetLane(2);
+		float* lengths = outPolarVectors.GetLane(0);
+		float* angles = outPolarVectors.GetLane(1);
+		float* heights = outPolarVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				Atan2(ys + block, xs + block, blockSize, angles + block);
+
+				for (size_t i = block; i < block + blockSize; ++i)
+				{
+					lengths[i] = std::hypot(xs[i], ys[i]);
+					heights[i] = zs[i];
+				}
+			}
+		});
+	}
+
+	void VectorToClassicPolarVector(const FVectorArray3& vectors, ClassicPolarVectorArray3& outPolarVectors)
+	{
+		const size_t count = vectors.GetSize();
+		outPolarVectors.Resize(count);
+
+		const float* xs = vectors.GetLane(0);
+		const float* ys = vectors.GetLane(1);
+		const float* zs = vectors.GetLane(2);
+		float* lengths = outPolarVectors.GetLane(0);
+		float* horAngles = outPolarVectors.GetLane(1);
+		float* vertAngles = outPolarVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float planarLengths[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					lengths[i] = std::hypot(xs[i], ys[i], zs[i]);
+					planarLengths[j] = std::hypot(xs[i], ys[i]);
+				}
+
+				Atan2(planarLengths, zs + block, blockSize, vertAngles + block);
+				Atan2(ys + block, xs + block, blockSize, horAngles + block);
+
+				for (size_t i = block; i < block + blockSize; ++i)
+				{
+					const bool isZero = !(lengths[i] > 0.f);
+					const bool isOnAxis = isZero || !(vertAngles[i] > 0.0001f);
+
+					horAngles[i] = isOnAxis ? 0.f : horAngles[i];
+					vertAngles[i] = isZero ? 0.f : vertAngles[i];
+				}
+			}
+		});
+	}
+
+	void VectorToPolarVector(const FVectorArray3& vectors, PolarVectorArray3& outPolarVectors)
+	{
+		const size_t count = vectors.GetSize();
+		outPolarVectors.Resize(count);
+
+		const float* xs = vectors.GetLane(0);
+		const float* ys = vectors.GetLane(1);
+		const float* zs = vectors.GetLane(2);
+		float* lengths = outPolarVectors.GetLane(0);
+		float* headings = outPolarVectors.GetLane(1);
+		float* pitches = outPolarVectors.GetLane(2);
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			bool isVertical[TRIG_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += TRIG_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, TRIG_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const float length = std::hypot(xs[i], ys[i], zs[i]);
+					const bool isZero = !(length > 0.f);
+
+					// There is no batched asin. The zero length case divides by one instead, its angles are masked away.
+					const float pitch = std::asin(-ys[i] / (isZero ? 1.f : length));
+					isVertical[j] = isZero || !(std::fabs(pitch) < Angle::PI_OVER_TWO * 0.9999f);
+
+					lengths[i] = length;
+					pitches[i] = isZero ? 0.f : pitch;
+				}
+
+				Atan2(xs + block, zs + block, blockSize, headings + block);
+
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					headings[i] = isVertical[j] ? 0.f : headings[i];
+				}
+			}
+		});
+	}
+
+	void CanonicalizeMany(PolarVectorArray2& inOutPolarVectors)
+	{
+		float* lengths = inOutPolarVectors.GetLane(0);
+		float* angles = inOutPolarVectors.GetLane(1);
+
+		ParallelFor(inOutPolarVectors.GetSize(), [=](const size_t begin, const size_t end)
+		{
+			size_t i = begin;
+			for (; i + 4 <= end; i += 4)
+			{
+				auto fourLengths = Simd::Load4(lengths + i);
+				auto fourAngles = Simd::Load4(angles + i);
+				CanonicalizePolarVector24(fourLengths, fourAngles);
+
+				Simd::Store4(lengths + i, fourLengths);
+				Simd::Store4(angles + i, fourAngles);
+			}
+
+			for (; i < end; ++i)
+			{
+				float length = lengths[i];
+				auto angle = Angle::CreateWithRadians(angles[i]);
+				Detail::CanonicalizePolarVector2(length, angle);
+
+				lengths[i] = length;
+				angles[i] = angle.GetRadians();
+			}
+		});
+	}
+
+	void CanonicalizeMany(ClassicPolarVectorArray3& inOutPolarVectors)
+	{
+		float* lengths = inOutPolarVectors.GetLane(0);
+		float* horAngles = inOutPolarVectors.GetLane(1);
+		float* vertAngles = inOutPolarVectors.GetLane(2);
+
+		ParallelFor(inOutPolarVectors.GetSize(), [=](const size_t begin, const size_t end)
+		{
+			size_t i = begin;
+			for (; i + 4 <= end; i += 4)
+			{
+				auto fourLengths = Simd::Load4(lengths + i);
+				auto fourHorAngles = Simd::Load4(horAngles + i);
+				auto fourVertAngles = Simd::Load4(vertAngles + i);
+				CanonicalizePolarVector34<true>(fourLengths, fourHorAngles, fourVertAngles);
+
+				Simd::Store4(lengths + i, fourLengths);
+				Simd::Store4(horAngles + i, fourHorAngles);
+				Simd::Store4(vertAngles + i, fourVertAngles);
+			}
+
+			for (; i < end; ++i)
+			{
+				float length = lengths[i];
+				auto horAngle = Angle::CreateWithRadians(horAngles[i]);
+				auto vertAngle = Angle::CreateWithRadians(vertAngles[i]);
+				Detail::CanonicalizeClassicPolarVector3(length, horAngle, vertAngle);
+
+				lengths[i] = length;
+				horAngles[i] = horAngle.GetRadians();
+				vertAngles[i] = vertAngle.GetRadians();
+			}
+		});
+	}
+
+	void CanonicalizeMany(PolarVectorArray3& inOutPolarVectors)
+	{
+		float* lengths = inOutPolarVectors.GetLane(0);
+		float* headings = inOutPolarVectors.GetLane(1);
+		float* pitches = inOutPolarVectors.GetLane(2);
+
+		ParallelFor(inOutPolarVectors.GetSize(), [=](const size_t begin, const size_t end)
+		{
+			size_t i = begin;
+			for (; i + 4 <= end; i += 4)
+			{
+				auto fourLengths = Simd::Load4(lengths + i);
+				auto fourHeadings = Simd::Load4(headings + i);
+				auto fourPitches = Simd::Load4(pitches + i);
+				CanonicalizePolarVector34<false>(fourLengths, fourHeadings, fourPitches);
+
+				Simd::Store4(lengths + i, fourLengths);
+				Simd::Store4(headings + i, fourHeadings);
+				Simd::Store4(pitches + i, fourPitches);
+			}
+
+			for (; i < end; ++i)
+			{
+				float length = lengths[i];
+				auto heading = Angle::CreateWithRadians(headings[i]);
+				auto pitch = Angle::CreateWithRadians(pitches[i]);
+				Detail::CanonicalizePolarVector3(length, heading, pitch);
+
+				lengths[i] = length;
+				headings[i] = heading.GetRadians();
+				pitches[i] = pitch.GetRadians();
+			}
+		});
+	}
+
+	void CanonicalizeMany(EulerAnglesArray& inOutEulerAngles)
+	{
+		float* headings = inOutEulerAngles.GetLane(0);
+		float* pitches = inOutEulerAngles.GetLane(1);
+		float* banks = inOutEulerAngles.GetLane(2);
+
+		ParallelFor(inOutEulerAngles.GetSize(), [=](const size_t begin, const size_t end)
+		{
+			size_t i = begin;
+			for (; i + 4 <= end; i += 4)
+			{
+				auto fourHeadings = Simd::Load4(headings + i);
+				auto fourPitches = Simd::Load4(pitches + i);
+				auto fourBanks = Simd::Load4(banks + i);
+				CanonicalizeEulerAngles4(fourHeadings, fourPitches, fourBanks);
+
+				Simd::Store4(headings + i, fourHeadings);
+				Simd::Store4(pitches + i, fourPitches);
+				Simd::Store4(banks + i, fourBanks);
+			}
+
+			for (; i < end; ++i)
+			{
+				auto heading = Angle::CreateWithRadians(headings[i]);
+				auto pitch = Angle::CreateWithRadians(pitches[i]);
+				auto bank = Angle::CreateWithRadians(banks[i]);
+				Detail::CanonicalizeEulerAngles(heading, pitch, bank);
+
+				headings[i] = heading.GetRadians();
+				pitches[i] = pitch.GetRadians();
+				banks[i] = bank.GetRadians();
+			}
+		});
+	}
+
+	size_t ValidateMany(const EulerAnglesArray& eulerAngles, std::vector<uint64_t>& outNonCanonicalBits)
+	{
+		constexpr size_t BITS_PER_WORD = 64;
+
+		const size_t count = eulerAngles.GetSize();
+		const size_t wordCount = (count + BITS_PER_WORD - 1) / BITS_PER_WORD;
+		outNonCanonicalBits.assign(wordCount, 0);
+
+		const float* headings = eulerAngles.GetLane(0);
+		const float* pitches = eulerAngles.GetLane(1);
+		const float* banks = eulerAngles.GetLane(2);
+		uint64_t* words = outNonCanonicalBits.data();
+
+		// Chunks are whole words, so no two threads write the same one.
+		ParallelFor(wordCount, [=](const size_t beginWord, const size_t endWord)
+		{
+			for (size_t word = beginWord; word < endWord; ++word)
+			{
+				const size_t begin = word * BITS_PER_WORD;
+				const size_t end = std::min(count, begin + BITS_PER_WORD);
+
+				uint64_t bits = 0;
+				for (size_t i = begin; i < end; ++i)
+				{
+					const auto angles = EulerAngles(
+						Angle::CreateWithRadians(headings[i]),
+						Angle::CreateWithRadians(pitches[i]),
+						Angle::CreateWithRadians(banks[i]));
+					const uint64_t isNonCanonical = IsCanonical(angles) ? 0 : 1;
+					bits |= isNonCanonical << (i - begin);
+				}
+				words[word] = bits;
+			}
+		});
+
+		size_t nonCanonicalCount = 0;
+		for (const uint64_t word : outNonCanonicalBits)
+		{
+			nonCanonicalCount += std::bitset<BITS_PER_WORD>(word).count();
+		}
+
+		return nonCanonicalCount;
+	}
+}
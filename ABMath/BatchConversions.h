@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Utilities.h"
+#include "VectorArray.h"
+
+namespace ABMath
+{
+	// Structure-of-arrays layouts used by the batched conversions.
+	// Quaternion lanes: w, x, y, z.
+	using QuaternionArray = FVectorArray4;
+	// EulerAngles lanes: heading, pitch, bank in radians.
+	using EulerAnglesArray = FVectorArray3;
+	// 3x3 matrix lanes: row * 3 + col.
+	using Matrix3Array = VectorArray<float, 9>;
+	// PolarVector2 lanes: length, angle in radians.
+	using PolarVectorArray2 = FVectorArray2;
+
+	// The 3D polar layouts share a lane count, so they are distinct types to keep the overloads apart.
+	// ClassicPolarVector3 lanes: length, horizontal angle, vertical angle in radians.
+	class ClassicPolarVectorArray3 : public FVectorArray3
+	{
+	public:
+		using FVectorArray3::FVectorArray3;
+	};
+
+	// PolarVector3 lanes: length, heading, pitch in radians.
+	class PolarVectorArray3 : public FVectorArray3
+	{
+	public:
+		using FVectorArray3::FVectorArray3;
+	};
+
+	// PolarCylindricalVector3 lanes: length, angle in radians, height.
+	class PolarCylindricalVectorArray3 : public FVectorArray3
+	{
+	public:
+		using FVectorArray3::FVectorArray3;
+	};
+
+	// Each batched conversion matches its single-object counterpart in Utilities.h, including
+	// gimbal lock handling. Inputs of at least 2 * MIN_PARALLEL_CHUNK_SIZE elements are split across threads, with
+	// at least MIN_PARALLEL_CHUNK_SIZE elements per thread; smaller ones run on the calling thread.
+	// Sines, cosines and atan2 go through the batched SinCos and Atan2 at DEFAULT_TRIG_PRECISION: the exact tier
+	// gives identical results, the approximate tiers agree within their error bound. Pitch still uses std::asin.
+	void QuaternionToEulerAngles(const QuaternionArray& quaternions, EulerAnglesArray& outEulerAngles);
+
+	void QuaternionToMatrix(const QuaternionArray& quaternions, Matrix3Array& outMatrices);
+
+	void MatrixToEulerAngles(const Matrix3Array& matrices, EulerAnglesArray& outEulerAngles);
+
+	void MatrixToQuaternion(const Matrix3Array& matrices, QuaternionArray& outQuaternions);
+
+	void EulerAnglesToQuaternion(const EulerAnglesArray& eulerAngles, QuaternionArray& outQuaternions);
+
+	// Batched CreateRotation<float, 3>: one heading-pitch-bank rotation matrix per set of angles.
+	void CreateRotation(const EulerAnglesArray& eulerAngles, Matrix3Array& outMatrices);
+
+	void AxisAngleToQuaternion(const FVectorArray3& axes, const std::vector<float>& radians, QuaternionArray& outQuaternions);
+
+	// Batched PolarVectorToVector. Angles go through the batched SinCos at DEFAULT_TRIG_PRECISION, so with the
+	// polynomial tier four angles are evaluated per SIMD step and results agree with the single-object version
+	// within that tier's error bound; the exact and table tiers give identical results.
+	void PolarVectorToVector(const PolarVectorArray2& polarVectors, FVectorArray2& outVectors);
+	void PolarVectorToVector(const PolarCylindricalVectorArray3& polarVectors, FVectorArray3& outVectors);
+	void PolarVectorToVector(const ClassicPolarVectorArray3& polarVectors, FVectorArray3& outVectors);
+	void PolarVectorToVector(const PolarVectorArray3& polarVectors, FVectorArray3& outVectors);
+
+	// Batched VectorToPolarVector and friends. Angles go through the batched Atan2 at DEFAULT_TRIG_PRECISION, so the
+	// exact tier gives identical results and the polynomial tier agrees within its error bound. The PolarVectorArray3
+	// pitch keeps std::asin like the single-object version.
+	void VectorToPolarVector(const FVectorArray2& vectors, PolarVectorArray2& outPolarVectors);
+	void VectorToPolarCylindricalVector(const FVectorArray3& vectors, PolarCylindricalVectorArray3& outPolarVectors);
+	void VectorToClassicPolarVector(const FVectorArray3& vectors, ClassicPolarVectorArray3& outPolarVectors);
+	void VectorToPolarVector(const FVectorArray3& vectors, PolarVectorArray3& outPolarVectors);
+
+	// Batched ToCanonicalForm, in place. Every element gets the same result as the single-object version.
+	void CanonicalizeMany(PolarVectorArray2& inOutPolarVectors);
+	void CanonicalizeMany(ClassicPolarVectorArray3& inOutPolarVectors);
+	void CanonicalizeMany(PolarVectorArray3& inOutPolarVectors);
+	void CanonicalizeMany(EulerAnglesArray& inOutEulerAngles);
+
+	// Batched Validate on an EulerAngles built from each set of lanes. Bit i % 64 of outNonCanonicalBits[i / 64]
+	// is set when entry i is not canonical; Validate the entry itself to find out which components are off.
+	// Returns the number of non-canonical entries.
+	size_t ValidateMany(const EulerAnglesArray& eulerAngles, std::vector<uint64_t>& outNonCanonicalBits);
+}
@@ -1,33 +1,82 @@
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "Angle.h"
+#include "Float.h"
 
 namespace ABMath
 {
+	class EulerAngles;
+
+	constexpr bool IsInGimbalLockState(const EulerAngles& eulerAngles);
+
 	class EulerAngles
 	{
 	public:
 		template<class T>
-		static EulerAngles CreateWithDegrees(const T& heading, const T& pitch, const T& bank)
+		static constexpr EulerAngles CreateWithDegrees(const T& heading, const T& pitch, const T& bank)
 		{
 			return EulerAngles(Angle::CreateWithDegrees(heading), Angle::CreateWithDegrees(pitch), Angle::CreateWithDegrees(bank));
 		}
 
 	public:
-		EulerAngles();
-		EulerAngles(const Angle& heading, const Angle& pitch, const Angle& bank);
+		constexpr EulerAngles()
+			: EulerAngles(Angle::Zero(), Angle::Zero(), Angle::Zero())
+		{}
+
+		constexpr EulerAngles(const Angle& heading, const Angle& pitch, const Angle& bank)
+			: _heading(heading)
+			, _pitch(pitch)
+			, _bank(bank)
+		{
+			ResetBankInGimbalLock();
+		}
+
+		constexpr Angle GetHeading() const
+		{
+			return _heading;
+		}
+
+		constexpr void SetHeading(const Angle& angle)
+		{
+			_heading = angle;
+		}
+
+		constexpr Angle GetPitch() const
+		{
+			return _pitch;
+		}
+
+		constexpr void SetPitch(const Angle& angle)
+		{
+			_pitch = angle;
+			ResetBankInGimbalLock();
+		}
 
-		Angle GetHeading() const;
-		void SetHeading(const Angle& angle);
+		constexpr Angle GetBank() const
+		{
+			return _bank;
+		}
 
-		Angle GetPitch() const;
-		void SetPitch(const Angle& angle);
+		constexpr void SetBank(const Angle& angle)
+		{
+			if (!IsInGimbalLockState(*this))
+				_bank = angle;
+		}
 
-		Angle GetBank() const;
-		void SetBank(const Angle& angle);
+	private:
+		constexpr void ResetBankInGimbalLock()
+		{
+			if (IsInGimbalLockState(*this))
+			{
+				_bank = Angle::Zero();
+			}
+		}
 
 	private:
 		Angle _heading;
@@ -35,8 +84,124 @@ namespace ABMath
 		Angle _bank;
 	};
 
-	bool IsInGimbalLockState(const EulerAngles& eulerAngles);
+	static_assert(std::is_trivially_copyable_v<EulerAngles>, "EulerAngles must stay trivially copyable");
+
+	constexpr bool IsInGimbalLockState(const Angle& pitch)
+	{
+		const float radians = pitch.GetRadians();
+		return AreFloatsEqual(radians < 0.f ? -radians : radians, Angle::PI_OVER_TWO);
+	}
+
+	constexpr bool IsInGimbalLockState(const EulerAngles& eulerAngles)
+	{
+		return IsInGimbalLockState(eulerAngles.GetPitch());
+	}
+
+	// Components of an EulerAngles that are outside their canonical range, as a bit set.
+	enum class EulerAnglesFlags : uint8_t
+	{
+		None = 0,
+		NonCanonicalHeading = 1 << 0,
+		NonCanonicalPitch = 1 << 1,
+		NonCanonicalBank = 1 << 2
+	};
+
+	constexpr EulerAnglesFlags operator|(const EulerAnglesFlags left, const EulerAnglesFlags right)
+	{
+		return static_cast<EulerAnglesFlags>(static_cast<uint8_t>(left) | static_cast<uint8_t>(right));
+	}
+
+	constexpr EulerAnglesFlags operator&(const EulerAnglesFlags left, const EulerAnglesFlags right)
+	{
+		return static_cast<EulerAnglesFlags>(static_cast<uint8_t>(left) & static_cast<uint8_t>(right));
+	}
+
+	constexpr bool HasFlags(const EulerAnglesFlags flags, const EulerAnglesFlags mask)
+	{
+		return (flags & mask) == mask;
+	}
+
+	namespace Detail
+	{
+		constexpr bool IsInPiRange(const Angle& angle)
+		{
+			return -Angle::CreatePi() < angle && angle <= Angle::CreatePi();
+		}
+
+		constexpr bool IsInPiOverTwoRange(const Angle& angle)
+		{
+			return -Angle::CreatePiOverTwo() <= angle && angle <= Angle::CreatePiOverTwo();
+		}
+	}
+
+	// Heading and bank must be in (-pi, pi], pitch in [-pi/2, pi/2].
+	constexpr EulerAnglesFlags Validate(const EulerAngles& eulerAngles)
+	{
+		auto result = EulerAnglesFlags::None;
+		if (!Detail::IsInPiRange(eulerAngles.GetHeading()))
+			result = result | EulerAnglesFlags::NonCanonicalHeading;
+		if (!Detail::IsInPiOverTwoRange(eulerAngles.GetPitch()))
+			result = result | EulerAnglesFlags::NonCanonicalPitch;
+		if (!Detail::IsInPiRange(eulerAngles.GetBank()))
+			result = result | EulerAnglesFlags::NonCanonicalBank;
+
+		return result;
+	}
+
+	constexpr bool IsCanonical(const EulerAngles& eulerAngles)
+	{
+		return Validate(eulerAngles) == EulerAnglesFlags::None;
+	}
+
+	namespace Detail
+	{
+		// Maps an angle outside (-pi, pi] into it and leaves the others untouched.
+		inline Angle WrapEulerAngle(const Angle& angle)
+		{
+			const Angle pi = Angle::CreatePi();
+			const Angle twoPi = Angle::CreateTwoPi();
+
+			Angle wrapped = angle + pi;
+			wrapped -= std::floor((wrapped / twoPi).GetRadians()) * twoPi;
+			wrapped -= pi;
+			wrapped = wrapped <= -pi ? wrapped + twoPi : wrapped;
+
+			return IsInPiRange(angle) ? angle : wrapped;
+		}
+
+		// Computes every case and selects the result, mirrored operation for operation by the four-lane kernel
+		// behind CanonicalizeMany. The bank of a gimbal locked input is ignored, as in EulerAngles.
+		inline void CanonicalizeEulerAngles(Angle& heading, Angle& pitch, Angle& bank)
+		{
+			const Angle pi = Angle::CreatePi();
+			const Angle piOverTwo = Angle::CreatePiOverTwo();
+
+			const Angle inputBank = IsInGimbalLockState(pitch) ? Angle::Zero() : bank;
+
+			const Angle wrappedPitch = WrapEulerAngle(pitch);
+			const bool isAbove = wrappedPitch > piOverTwo;
+			const bool isBelow = wrappedPitch < -piOverTwo;
+			const bool isFlipped = isAbove || isBelow;
+			const Angle foldedPitch = isAbove ? pi - wrappedPitch : (isBelow ? -pi - wrappedPitch : wrappedPitch);
+
+			const Angle turnedHeading = isFlipped ? heading + pi : heading;
+			const Angle turnedBank = isFlipped ? inputBank + pi : inputBank;
+
+			// In gimbal lock heading and bank rotate about the same axis, so bank is folded into heading.
+			const bool isLocked = IsInGimbalLockState(foldedPitch);
+
+			heading = WrapEulerAngle(isLocked ? turnedHeading + turnedBank : turnedHeading);
+			pitch = foldedPitch;
+			bank = isLocked ? Angle::Zero() : WrapEulerAngle(turnedBank);
+		}
+	}
 
 	std::string ToString(const EulerAngles& eulerAngles);
+	// Appends one message per flag to outDetails.
+	void AppendDetails(const EulerAnglesFlags flags, std::vector<std::string>& outDetails);
 	bool IsCanonical(const EulerAngles& eulerAngles, std::vector<std::string>* outDetails);
+
+	// Heading and bank in (-pi, pi], pitch in [-pi/2, pi/2] and zero bank in gimbal lock.
+	void ToCanonicalForm(EulerAngles& eulerAngles);
+	EulerAngles CreateCanonicalForm(const EulerAngles& eulerAngles);
 }
\ No newline at end of file
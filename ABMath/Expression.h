@@ -0,0 +1,230 @@
+#pragma once
+
+#include <functional>
+
+#include "Matrix.h"
+#include "Vector.h"
+
+namespace ABMath
+{
+	// Opt-in lazy element-wise arithmetic: Lazy(a) + Lazy(b) * s - Lazy(c) builds an expression
+	// that is evaluated in a single loop when converted to Vector/Matrix or passed to Evaluate.
+	// Expressions keep references to their operands, so evaluate them within the operands' lifetime.
+	namespace Detail
+	{
+		template<class Shape>
+		struct ExpressionTraits;
+
+		template<class T, size_t SIZE>
+		struct ExpressionTraits<Vector<T, SIZE>>
+		{
+			using ValueType = T;
+			static constexpr size_t COUNT = SIZE;
+			static constexpr bool DIVIDES_BY_RECIPROCAL = true;
+
+			static Vector<T, SIZE> CreateZero()
+			{
+				return Vector<T, SIZE>::Zero();
+			}
+		};
+
+		template<class T, size_t SIZE>
+		struct ExpressionTraits<Matrix<T, SIZE>>
+		{
+			using ValueType = T;
+			static constexpr size_t COUNT = SIZE * SIZE;
+			static constexpr bool DIVIDES_BY_RECIPROCAL = false;
+
+			static Matrix<T, SIZE> CreateZero()
+			{
+				return Matrix<T, SIZE>();
+			}
+		};
+
+		template<class Shape>
+		struct ReferenceNode
+		{
+			const Shape& operand;
+
+			auto At(const size_t index) const
+			{
+				return operand.GetData()[index];
+			}
+		};
+
+		template<class Left, class Right, class Operation>
+		struct BinaryNode
+		{
+			Left left;
+			Right right;
+
+			auto At(const size_t index) const
+			{
+				return Operation()(left.At(index), right.At(index));
+			}
+		};
+
+		template<class Operand, class T, class Operation>
+		struct ScalarNode
+		{
+			Operand operand;
+			T scalar;
+
+			T At(const size_t index) const
+			{
+				return Operation()(operand.At(index), scalar);
+			}
+		};
+
+		template<class Operand>
+		struct NegateNode
+		{
+			Operand operand;
+
+			auto At(const size_t index) const
+			{
+				return -operand.At(index);
+			}
+		};
+	}
+
+	template<class Shape, class Node>
+	class Expression
+	{
+	public:
+		using ValueType = typename Detail::ExpressionTraits<Shape>::ValueType;
+		static constexpr size_t COUNT = Detail::ExpressionTraits<Shape>::COUNT;
+
+	public:
+		explicit Expression(const Node& node)
+			: _node(node)
+		{}
+
+		ValueType At(const size_t index) const
+		{
+			return _node.At(index);
+		}
+
+		const Node& GetNode() const
+		{
+			return _node;
+		}
+
+		operator Shape() const
+		{
+			auto result = Detail::ExpressionTraits<Shape>::CreateZero();
+			Evaluate(*this, result);
+			return result;
+		}
+
+	private:
+		Node _node;
+	};
+
+	template<class T, size_t SIZE>
+	Expression<Vector<T, SIZE>, Detail::ReferenceNode<Vector<T, SIZE>>> Lazy(const Vector<T, SIZE>& vector)
+	{
+		using Node = Detail::ReferenceNode<Vector<T, SIZE>>;
+		return Expression<Vector<T, SIZE>, Node>(Node{ vector });
+	}
+
+	template<class T, size_t SIZE>
+	Expression<Matrix<T, SIZE>, Detail::ReferenceNode<Matrix<T, SIZE>>> Lazy(const Matrix<T, SIZE>& matrix)
+	{
+		using Node = Detail::ReferenceNode<Matrix<T, SIZE>>;
+		return Expression<Matrix<T, SIZE>, Node>(Node{ matrix });
+	}
+
+	// The operands may alias outResult: every element only depends on the same element of its operands.
+	template<class Shape, class Node>
+	void Evaluate(const Expression<Shape, Node>& expression, Shape& outResult)
+	{
+		using ValueType = typename Expression<Shape, Node>::ValueType;
+
+		ValueType* result = outResult.GetData();
+		ForEachIndex<Expression<Shape, Node>::COUNT>([result, &expression](const size_t index)
+		{
+			result[index] = expression.At(index);
+		});
+	}
+
+	template<class Shape, class Node>
+	Shape Evaluate(const Expression<Shape, Node>& expression)
+	{
+		return expression;
+	}
+
+	template<class Shape, class Left, class Right>
+	auto operator+(const Expression<Shape, Left>& left, const Expression<Shape, Right>& right)
+	{
+		using Node = Detail::BinaryNode<Left, Right, std::plus<>>;
+		return Expression<Shape, Node>(Node{ left.GetNode(), right.GetNode() });
+	}
+
+	template<class Shape, class Left>
+	auto operator+(const Expression<Shape, Left>& left, const Shape& right)
+	{
+		return left + Lazy(right);
+	}
+
+	template<class Shape, class Right>
+	auto operator+(const Shape& left, const Expression<Shape, Right>& right)
+	{
+		return Lazy(left) + right;
+	}
+
+	template<class Shape, class Left, class Right>
+	auto operator-(const Expression<Shape, Left>& left, const Expression<Shape, Right>& right)
+	{
+		using Node = Detail::BinaryNode<Left, Right, std::minus<>>;
+		return Expression<Shape, Node>(Node{ left.GetNode(), right.GetNode() });
+	}
+
+	template<class Shape, class Left>
+	auto operator-(const Expression<Shape, Left>& left, const Shape& right)
+	{
+		return left - Lazy(right);
+	}
+
+	template<class Shape, class Right>
+	auto operator-(const Shape& left, const Expression<Shape, Right>& right)
+	{
+		return Lazy(left) - right;
+	}
+
+	template<class Shape, class Operand>
+	auto operator-(const Expression<Shape, Operand>& expression)
+	{
+		using Node = Detail::NegateNode<Operand>;
+		return Expression<Shape, Node>(Node{ expression.GetNode() });
+	}
+
+	template<class Shape, class Operand>
+	auto operator*(const Expression<Shape, Operand>& expression, const typename Expression<Shape, Operand>::ValueType& factor)
+	{
+		using Node = Detail::ScalarNode<Operand, typename Expression<Shape, Operand>::ValueType, std::multiplies<>>;
+		return Expression<Shape, Node>(Node{ expression.GetNode(), factor });
+	}
+
+	template<class Shape, class Operand>
+	auto operator*(const typename Expression<Shape, Operand>::ValueType& factor, const Expression<Shape, Operand>& expression)
+	{
+		return expression * factor;
+	}
+
+	// Matches Divide for each shape: vectors multiply by the reciprocal, matrices divide every element.
+	template<class Shape, class Operand>
+	auto operator/(const Expression<Shape, Operand>& expression, const typename Expression<Shape, Operand>::ValueType& divider)
+	{
+		using ValueType = typename Expression<Shape, Operand>::ValueType;
+		if constexpr (Detail::ExpressionTraits<Shape>::DIVIDES_BY_RECIPROCAL)
+		{
+			return expression * (ValueType(1) / divider);
+		}
+		else
+		{
+			using Node = Detail::ScalarNode<Operand, ValueType, std::divides<>>;
+			return Expression<Shape, Node>(Node{ expression.GetNode(), divider });
+		}
+	}
+}
@@ -6,13 +6,14 @@
 namespace ABMath
 {
 	template<class T>
-	bool AreFloatsEqual(const T& left, const T& right)
+	constexpr bool AreFloatsEqual(const T& left, const T& right)
 	{
-		return std::abs(left - right) < std::numeric_limits<T>::epsilon();
+		const T difference = left - right;
+		return (difference < T(0) ? -difference : difference) < std::numeric_limits<T>::epsilon();
 	}
 
 	template<class T>
-	bool IsFloatEqualOrLarger(const T& left, const T& right)
+	constexpr bool IsFloatEqualOrLarger(const T& left, const T& right)
 	{
 		return AreFloatsEqual(left, right) || left > right;
 	}
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <functional>
 #include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
-#include <vector>
+#include <type_traits>
+#include <utility>
 
 #include "Angle.h"
+#include "EulerAngles.h"
 #include "Float.h"
+#include "Simd.h"
+#include "Trigonometry.h"
 
 namespace ABMath
 {
@@ -17,55 +22,53 @@ namespace ABMath
 	class Matrix final
 	{
 	public:
-		using RowType = std::vector<T>;
-		using DataType = std::vector<RowType>;
+		using RowType = std::array<T, SIZE>;
+		using DataType = std::array<T, SIZE * SIZE>;
 
 	public:
-		static Matrix Identity()
+		static constexpr Matrix Identity()
 		{
 			auto result = Matrix();
 
-			ForEach(result, [&result](const size_t row, const size_t col)
+			for (size_t i = 0; i < SIZE; ++i)
 			{
-				if (col == row)
-				{
-					result.At(row, col) = 1;
-				}
-			});
+				result.At(i, i) = T(1);
+			}
 
 			return result;
 		}
 
-		Matrix()
-		{
-			for (size_t row = 0; row < SIZE; ++row)
-			{
-				_data.push_back(RowType());
-				for (size_t col = 0; col < SIZE; ++col)
-				{
-					_data.back().push_back(T());
-				}
-			}
-		}
+		constexpr Matrix()
+			: _data()
+		{}
 
-		explicit Matrix(DataType data)
+		constexpr explicit Matrix(const DataType& data)
 			: _data(data)
 		{}
 
-		const T& At(const size_t row, const size_t col) const
+		constexpr const T& At(const size_t row, const size_t col) const
 		{
-			return _data[row][col];
+			return _data[row * SIZE + col];
 		}
 
-		T& At(const size_t row, const size_t col)
+		constexpr T& At(const size_t row, const size_t col)
 		{
 			const auto& constThis = static_cast<const Matrix&>(*this);
 			return const_cast<T&>(constThis.At(row, col));
 		}
-		
+
+		const T* GetData() const
+		{
+			return _data.data();
+		}
+
+		T* GetData()
+		{
+			return _data.data();
+		}
 
 	private:
-		DataType _data;
+		alignas(16) DataType _data;
 	};
 
 	template<size_t SIZE>
@@ -80,18 +83,50 @@ namespace ABMath
 	using FMatrix3 = FMatrix<3>;
 	using FMatrix4 = FMatrix<4>;
 
+	static_assert(sizeof(FMatrix4) == 16 * sizeof(float));
+	static_assert(alignof(FMatrix4) == 16);
+	static_assert(std::is_trivially_copyable_v<FMatrix4>);
+	static_assert(std::is_nothrow_move_constructible_v<FMatrix4> && std::is_nothrow_move_assignable_v<FMatrix4>);
+
 	template<class T, size_t SIZE>
-	void ForEach(Matrix<T, SIZE>& matrix, const std::function<void(const size_t, const size_t)>& func)
+	constexpr bool IS_SIMD_MATRIX = Simd::IS_ENABLED && std::is_same_v<T, float> && SIZE == 4;
+
+	constexpr size_t MAX_UNROLLED_FOR_EACH_COUNT = 16;
+
+	namespace Detail
 	{
-		for (size_t row = 0; row < SIZE; ++row)
+		template<class Func, size_t... INDICES>
+		constexpr void ForEachIndexUnrolled(Func& func, std::index_sequence<INDICES...>)
 		{
-			for (size_t col = 0; col < SIZE; ++col)
+			(func(INDICES), ...);
+		}
+	}
+
+	template<size_t COUNT, class Func>
+	constexpr void ForEachIndex(Func&& func)
+	{
+		if constexpr (COUNT <= MAX_UNROLLED_FOR_EACH_COUNT)
+		{
+			Detail::ForEachIndexUnrolled(func, std::make_index_sequence<COUNT>());
+		}
+		else
+		{
+			for (size_t i = 0; i < COUNT; ++i)
 			{
-				func(row, col);
+				func(i);
 			}
 		}
 	}
 
+	template<class T, size_t SIZE, class Func>
+	constexpr void ForEach(const Matrix<T, SIZE>&, Func&& func)
+	{
+		ForEachIndex<SIZE * SIZE>([&func](const size_t index)
+		{
+			func(index / SIZE, index % SIZE);
+		});
+	}
+
 	template<class T, size_t SIZE>
 	bool AreEqual(const Matrix<T, SIZE>& left, const Matrix<T, SIZE>& right, const T epsilon = std::numeric_limits<T>::epsilon())
 	{
@@ -99,7 +134,7 @@ namespace ABMath
 		{
 			for (size_t col = 0; col < SIZE; ++col)
 			{
-				if (std::numeric_limits<T>::is_integer)
+				if constexpr (std::numeric_limits<T>::is_integer)
 				{
 					if (left.At(row, col) != right.At(row, col))
 					{
@@ -108,7 +143,8 @@ namespace ABMath
 				}
 				else
 				{
-					if (!AreFloatsEqual(left.At(row, col), right.At(row, col)))
+					const T difference = left.At(row, col) - right.At(row, col);
+					if (!(std::abs(difference) < epsilon))
 					{
 						return false;
 					}
@@ -124,12 +160,36 @@ namespace ABMath
 	{
 		auto matrix = Matrix<T, SIZE>();
 
+		if constexpr (IS_SIMD_MATRIX<T, SIZE>)
+		{
+			const Simd::Float4 rightRows[] = {
+				Simd::Load4(right.GetData()),
+				Simd::Load4(right.GetData() + 4),
+				Simd::Load4(right.GetData() + 8),
+				Simd::Load4(right.GetData() + 12)
+			};
+
+			ForEachIndex<SIZE>([&matrix, &left, &rightRows](const size_t row)
+			{
+				const float* leftRow = left.GetData() + row * SIZE;
+				auto sum = Simd::Multiply(Simd::Splat(leftRow[0]), rightRows[0]);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[1]), rightRows[1], sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[2]), rightRows[2], sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[3]), rightRows[3], sum);
+				Simd::Store4(matrix.GetData() + row * SIZE, sum);
+			});
+
+			return matrix;
+		}
+
 		ForEach(matrix, [&matrix, &left, &right](const size_t row, const size_t col)
 		{
-			for (size_t c = 0; c < SIZE; ++c)
+			auto sum = T();
+			ForEachIndex<SIZE>([&sum, &left, &right, row, col](const size_t c)
 			{
-				matrix.At(row, col) += left.At(row, c) * right.At(c, col);
-			}
+				sum += left.At(row, c) * right.At(c, col);
+			});
+			matrix.At(row, col) = sum;
 		});
 
 		return matrix;
@@ -148,97 +208,422 @@ namespace ABMath
 		return result;
 	}
 
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> Divide(Matrix<T, SIZE>&& matrix, const T& divider)
+	{
+		ForEach(matrix, [&matrix, &divider](const size_t row, const size_t col)
+		{
+			matrix.At(row, col) /= divider;
+		});
+
+		return std::move(matrix);
+	}
+
+	template<class T>
+	T Determinant(const Matrix<T, 1>& matrix)
+	{
+		return matrix.At(0, 0);
+	}
+
 	template<class T>
 	T Determinant(const Matrix<T, 2>& matrix)
 	{
 		return matrix.At(0, 0) * matrix.At(1, 1) - matrix.At(0, 1) * matrix.At(1, 0);
 	}
 
+	template<class T>
+	T Determinant(const Matrix<T, 3>& matrix)
+	{
+		return matrix.At(0, 0) * (matrix.At(1, 1) * matrix.At(2, 2) - matrix.At(1, 2) * matrix.At(2, 1))
+			- matrix.At(0, 1) * (matrix.At(1, 0) * matrix.At(2, 2) - matrix.At(1, 2) * matrix.At(2, 0))
+			+ matrix.At(0, 2) * (matrix.At(1, 0) * matrix.At(2, 1) - matrix.At(1, 1) * matrix.At(2, 0));
+	}
+
+	template<class T>
+	T Determinant(const Matrix<T, 4>& m)
+	{
+		const T s0 = m.At(0, 0) * m.At(1, 1) - m.At(1, 0) * m.At(0, 1);
+		const T s1 = m.At(0, 0) * m.At(1, 2) - m.At(1, 0) * m.At(0, 2);
+		const T s2 = m.At(0, 0) * m.At(1, 3) - m.At(1, 0) * m.At(0, 3);
+		const T s3 = m.At(0, 1) * m.At(1, 2) - m.At(1, 1) * m.At(0, 2);
+		const T s4 = m.At(0, 1) * m.At(1, 3) - m.At(1, 1) * m.At(0, 3);
+		const T s5 = m.At(0, 2) * m.At(1, 3) - m.At(1, 2) * m.At(0, 3);
+
+		const T c0 = m.At(2, 0) * m.At(3, 1) - m.At(3, 0) * m.At(2, 1);
+		const T c1 = m.At(2, 0) * m.At(3, 2) - m.At(3, 0) * m.At(2, 2);
+		const T c2 = m.At(2, 0) * m.At(3, 3) - m.At(3, 0) * m.At(2, 3);
+		const T c3 = m.At(2, 1) * m.At(3, 2) - m.At(3, 1) * m.At(2, 2);
+		const T c4 = m.At(2, 1) * m.At(3, 3) - m.At(3, 1) * m.At(2, 3);
+		const T c5 = m.At(2, 2) * m.At(3, 3) - m.At(3, 2) * m.At(2, 3);
+
+		return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	}
+
 	template<class T, size_t SIZE>
 	T Minor(const Matrix<T, SIZE>& matrix, const size_t row, const size_t col)
 	{
 		using SubMatrix = Matrix<T, SIZE - 1>;
-		auto subMatrixData = SubMatrix::DataType();
+		auto subMatrix = SubMatrix();
 
+		size_t subRow = 0;
 		for (size_t r = 0; r < SIZE; ++r)
 		{
 			if (r == row) { continue; }
 
-			auto rowData = SubMatrix::RowType();
+			size_t subCol = 0;
 			for (size_t c = 0; c < SIZE; ++c)
 			{
 				if (c == col) { continue; }
 
-				rowData.push_back(matrix.At(r, c));
+				subMatrix.At(subRow, subCol++) = matrix.At(r, c);
 			}
-			subMatrixData.push_back(rowData);
+			++subRow;
 		}
 
-		return Determinant(SubMatrix(subMatrixData));
+		return Determinant(subMatrix);
 	}
 
 	template<class T, size_t SIZE>
 	T Cofactor(const Matrix<T, SIZE>& matrix, const size_t row, const size_t col)
 	{
-		return static_cast<T>(std::pow(-1, row + col)) * Minor(matrix, row, col);
+		const T sign = ((row + col) % 2 == 0) ? T(1) : T(-1);
+		return sign * Minor(matrix, row, col);
 	}
 
-	template<class T, size_t SIZE>
-	T Determinant(const Matrix<T, SIZE>& matrix)
+	namespace Detail
 	{
-		const size_t row = 0;
-
-		auto sum = T();
-		for (size_t col = 0; col < SIZE; ++col)
+		template<class T, size_t SIZE>
+		T CalculateMaxAbsElement(const Matrix<T, SIZE>& matrix, const size_t row)
 		{
-			sum += matrix.At(row, col) * Cofactor(matrix, row, col);
+			auto result = T();
+			for (size_t col = 0; col < SIZE; ++col)
+			{
+				result = std::max(result, std::abs(matrix.At(row, col)));
+			}
+
+			return result;
 		}
 
-		return sum;
+		// The Hadamard bound: |det| never exceeds the product of the row lengths, and reaches it for orthogonal rows.
+		template<class T, size_t SIZE>
+		T CalculateRowLengthProduct(const Matrix<T, SIZE>& matrix)
+		{
+			auto result = T(1);
+			for (size_t row = 0; row < SIZE; ++row)
+			{
+				auto squaredLength = T();
+				for (size_t col = 0; col < SIZE; ++col)
+				{
+					squaredLength += matrix.At(row, col) * matrix.At(row, col);
+				}
+				result *= std::sqrt(squaredLength);
+			}
+
+			return result;
+		}
 	}
 
+	template<size_t SIZE>
+	using Permutation = std::array<size_t, SIZE>;
+
+	// Doolittle LU decomposition with partial pivoting: the rows of matrix reordered by outPermutation
+	// equal L * U, where L (unit diagonal) is stored below the diagonal of outLU and U on and above it.
+	// Returns false if a pivot is at most relativePivotThreshold times the largest element of the row it came from,
+	// so scaling a row never changes the outcome. A threshold of zero only rejects exact zero pivots.
 	template<class T, size_t SIZE>
-	void Transpose(Matrix<T, SIZE>& matrix)
+	bool DecomposeLU(const Matrix<T, SIZE>& matrix, Matrix<T, SIZE>& outLU, Permutation<SIZE>& outPermutation, T& outPermutationSign,
+		const T relativePivotThreshold = std::numeric_limits<T>::epsilon())
 	{
-		//TODO: AB = foreach
-		for (size_t row = 0; row < SIZE; ++row)
+		static_assert(std::is_floating_point_v<T>);
+
+		outLU = matrix;
+		outPermutationSign = T(1);
+
+		auto rowScales = typename Matrix<T, SIZE>::RowType();
+		for (size_t i = 0; i < SIZE; ++i)
 		{
-			for (size_t col = 0; col < SIZE; ++col)
+			outPermutation[i] = i;
+			rowScales[i] = Detail::CalculateMaxAbsElement(matrix, i);
+		}
+
+		for (size_t k = 0; k < SIZE; ++k)
+		{
+			size_t pivotRow = k;
+			for (size_t row = k + 1; row < SIZE; ++row)
+			{
+				if (std::abs(outLU.At(row, k)) > std::abs(outLU.At(pivotRow, k)))
+				{
+					pivotRow = row;
+				}
+			}
+
+			if (!(std::abs(outLU.At(pivotRow, k)) > relativePivotThreshold * rowScales[outPermutation[pivotRow]]))
+			{
+				return false;
+			}
+
+			if (pivotRow != k)
 			{
-				if (col > row)
+				for (size_t col = 0; col < SIZE; ++col)
 				{
-					std::swap(matrix.At(row, col), matrix.At(col, row));
+					std::swap(outLU.At(k, col), outLU.At(pivotRow, col));
+				}
+				std::swap(outPermutation[k], outPermutation[pivotRow]);
+				outPermutationSign = -outPermutationSign;
+			}
+
+			const T pivotInv = T(1) / outLU.At(k, k);
+			for (size_t row = k + 1; row < SIZE; ++row)
+			{
+				const T factor = outLU.At(row, k) * pivotInv;
+				outLU.At(row, k) = factor;
+				for (size_t col = k + 1; col < SIZE; ++col)
+				{
+					outLU.At(row, col) -= factor * outLU.At(k, col);
 				}
 			}
 		}
+
+		return true;
 	}
 
+	// Solves A * x = b for a column vector b, given the output of DecomposeLU for A.
 	template<class T, size_t SIZE>
-	Matrix<T, SIZE> Adjoint(const Matrix<T, SIZE>& matrix)
+	typename Matrix<T, SIZE>::RowType SolveLU(const Matrix<T, SIZE>& lu, const Permutation<SIZE>& permutation, const typename Matrix<T, SIZE>::RowType& b)
 	{
-		auto result = Matrix<T, SIZE>();
+		auto x = typename Matrix<T, SIZE>::RowType();
 
-		//TODO: AB = foreach
 		for (size_t row = 0; row < SIZE; ++row)
 		{
+			T sum = b[permutation[row]];
+			for (size_t col = 0; col < row; ++col)
+			{
+				sum -= lu.At(row, col) * x[col];
+			}
+			x[row] = sum;
+		}
+
+		for (size_t row = SIZE; row-- > 0;)
+		{
+			T sum = x[row];
+			for (size_t col = row + 1; col < SIZE; ++col)
+			{
+				sum -= lu.At(row, col) * x[col];
+			}
+			x[row] = sum / lu.At(row, row);
+		}
+
+		return x;
+	}
+
+	template<class T, size_t SIZE>
+	T Determinant(const Matrix<T, SIZE>& matrix)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			auto lu = Matrix<T, SIZE>();
+			auto permutation = Permutation<SIZE>();
+			// No cutoff: tiny pivots are real, only an exact zero one makes the determinant zero.
+			auto det = T();
+			if (!DecomposeLU(matrix, lu, permutation, det, T(0)))
+			{
+				return T(0);
+			}
+
+			ForEachIndex<SIZE>([&det, &lu](const size_t i)
+			{
+				det *= lu.At(i, i);
+			});
+
+			return det;
+		}
+		else
+		{
+			const size_t row = 0;
+
+			auto sum = T();
 			for (size_t col = 0; col < SIZE; ++col)
 			{
-				result.At(row, col) = Cofactor(matrix, row, col);
+				sum += matrix.At(row, col) * Cofactor(matrix, row, col);
+			}
+
+			return sum;
+		}
+	}
+
+	template<class T, size_t SIZE>
+	void Transpose(Matrix<T, SIZE>& matrix)
+	{
+		ForEach(matrix, [&matrix](const size_t row, const size_t col)
+		{
+			if (col > row)
+			{
+				std::swap(matrix.At(row, col), matrix.At(col, row));
 			}
+		});
+	}
+
+	namespace Detail
+	{
+		// Closed-form adjugate for SIZE <= 4; returns the determinant.
+		template<class T>
+		T CalculateAdjugate(const Matrix<T, 2>& m, Matrix<T, 2>& outAdjugate)
+		{
+			outAdjugate.At(0, 0) = m.At(1, 1);
+			outAdjugate.At(0, 1) = -m.At(0, 1);
+			outAdjugate.At(1, 0) = -m.At(1, 0);
+			outAdjugate.At(1, 1) = m.At(0, 0);
+
+			return Determinant(m);
+		}
+
+		template<class T>
+		T CalculateAdjugate(const Matrix<T, 3>& m, Matrix<T, 3>& outAdjugate)
+		{
+			outAdjugate.At(0, 0) = m.At(1, 1) * m.At(2, 2) - m.At(1, 2) * m.At(2, 1);
+			outAdjugate.At(0, 1) = m.At(0, 2) * m.At(2, 1) - m.At(0, 1) * m.At(2, 2);
+			outAdjugate.At(0, 2) = m.At(0, 1) * m.At(1, 2) - m.At(0, 2) * m.At(1, 1);
+			outAdjugate.At(1, 0) = m.At(1, 2) * m.At(2, 0) - m.At(1, 0) * m.At(2, 2);
+			outAdjugate.At(1, 1) = m.At(0, 0) * m.At(2, 2) - m.At(0, 2) * m.At(2, 0);
+			outAdjugate.At(1, 2) = m.At(0, 2) * m.At(1, 0) - m.At(0, 0) * m.At(1, 2);
+			outAdjugate.At(2, 0) = m.At(1, 0) * m.At(2, 1) - m.At(1, 1) * m.At(2, 0);
+			outAdjugate.At(2, 1) = m.At(0, 1) * m.At(2, 0) - m.At(0, 0) * m.At(2, 1);
+			outAdjugate.At(2, 2) = m.At(0, 0) * m.At(1, 1) - m.At(0, 1) * m.At(1, 0);
+
+			return m.At(0, 0) * outAdjugate.At(0, 0) + m.At(0, 1) * outAdjugate.At(1, 0) + m.At(0, 2) * outAdjugate.At(2, 0);
+		}
+
+		template<class T>
+		T CalculateAdjugate(const Matrix<T, 4>& m, Matrix<T, 4>& outAdjugate)
+		{
+			const T s0 = m.At(0, 0) * m.At(1, 1) - m.At(1, 0) * m.At(0, 1);
+			const T s1 = m.At(0, 0) * m.At(1, 2) - m.At(1, 0) * m.At(0, 2);
+			const T s2 = m.At(0, 0) * m.At(1, 3) - m.At(1, 0) * m.At(0, 3);
+			const T s3 = m.At(0, 1) * m.At(1, 2) - m.At(1, 1) * m.At(0, 2);
+			const T s4 = m.At(0, 1) * m.At(1, 3) - m.At(1, 1) * m.At(0, 3);
+			const T s5 = m.At(0, 2) * m.At(1, 3) - m.At(1, 2) * m.At(0, 3);
+
+			const T c0 = m.At(2, 0) * m.At(3, 1) - m.At(3, 0) * m.At(2, 1);
+			const T c1 = m.At(2, 0) * m.At(3, 2) - m.At(3, 0) * m.At(2, 2);
+			const T c2 = m.At(2, 0) * m.At(3, 3) - m.At(3, 0) * m.At(2, 3);
+			const T c3 = m.At(2, 1) * m.At(3, 2) - m.At(3, 1) * m.At(2, 2);
+			const T c4 = m.At(2, 1) * m.At(3, 3) - m.At(3, 1) * m.At(2, 3);
+			const T c5 = m.At(2, 2) * m.At(3, 3) - m.At(3, 2) * m.At(2, 3);
+
+			outAdjugate.At(0, 0) = m.At(1, 1) * c5 - m.At(1, 2) * c4 + m.At(1, 3) * c3;
+			outAdjugate.At(0, 1) = -m.At(0, 1) * c5 + m.At(0, 2) * c4 - m.At(0, 3) * c3;
+			outAdjugate.At(0, 2) = m.At(3, 1) * s5 - m.At(3, 2) * s4 + m.At(3, 3) * s3;
+			outAdjugate.At(0, 3) = -m.At(2, 1) * s5 + m.At(2, 2) * s4 - m.At(2, 3) * s3;
+
+			outAdjugate.At(1, 0) = -m.At(1, 0) * c5 + m.At(1, 2) * c2 - m.At(1, 3) * c1;
+			outAdjugate.At(1, 1) = m.At(0, 0) * c5 - m.At(0, 2) * c2 + m.At(0, 3) * c1;
+			outAdjugate.At(1, 2) = -m.At(3, 0) * s5 + m.At(3, 2) * s2 - m.At(3, 3) * s1;
+			outAdjugate.At(1, 3) = m.At(2, 0) * s5 - m.At(2, 2) * s2 + m.At(2, 3) * s1;
+
+			outAdjugate.At(2, 0) = m.At(1, 0) * c4 - m.At(1, 1) * c2 + m.At(1, 3) * c0;
+			outAdjugate.At(2, 1) = -m.At(0, 0) * c4 + m.At(0, 1) * c2 - m.At(0, 3) * c0;
+			outAdjugate.At(2, 2) = m.At(3, 0) * s4 - m.At(3, 1) * s2 + m.At(3, 3) * s0;
+			outAdjugate.At(2, 3) = -m.At(2, 0) * s4 + m.At(2, 1) * s2 - m.At(2, 3) * s0;
+
+			outAdjugate.At(3, 0) = -m.At(1, 0) * c3 + m.At(1, 1) * c1 - m.At(1, 2) * c0;
+			outAdjugate.At(3, 1) = m.At(0, 0) * c3 - m.At(0, 1) * c1 + m.At(0, 2) * c0;
+			outAdjugate.At(3, 2) = -m.At(3, 0) * s3 + m.At(3, 1) * s1 - m.At(3, 2) * s0;
+			outAdjugate.At(3, 3) = m.At(2, 0) * s3 - m.At(2, 1) * s1 + m.At(2, 2) * s0;
+
+			return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 		}
+	}
+
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> Adjoint(const Matrix<T, SIZE>& matrix)
+	{
+		auto result = Matrix<T, SIZE>();
+
+		if constexpr (SIZE >= 2 && SIZE <= 4)
+		{
+			Detail::CalculateAdjugate(matrix, result);
+			return result;
+		}
+
+		ForEach(result, [&result, &matrix](const size_t row, const size_t col)
+		{
+			result.At(row, col) = Cofactor(matrix, row, col);
+		});
 
 		Transpose(result);
 
 		return result;
 	}
 
+	// Returns false and leaves outInverse untouched if the matrix is singular.
+	template<class T, size_t SIZE>
+	bool Inverse(const Matrix<T, SIZE>& matrix, Matrix<T, SIZE>& outInverse)
+	{
+		if constexpr (std::is_floating_point_v<T> && SIZE >= 2 && SIZE <= 4)
+		{
+			auto adjugate = Matrix<T, SIZE>();
+			const T det = Detail::CalculateAdjugate(matrix, adjugate);
+
+			// Relative to the Hadamard bound, so scaling a row never changes the outcome.
+			const T singularityThreshold = std::numeric_limits<T>::epsilon() * Detail::CalculateRowLengthProduct(matrix);
+			if (!(std::abs(det) > singularityThreshold))
+			{
+				return false;
+			}
+
+			const T detInv = T(1) / det;
+			ForEach(outInverse, [&outInverse, &adjugate, detInv](const size_t row, const size_t col)
+			{
+				outInverse.At(row, col) = adjugate.At(row, col) * detInv;
+			});
+
+			return true;
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			auto lu = Matrix<T, SIZE>();
+			auto permutation = Permutation<SIZE>();
+			auto sign = T();
+			if (!DecomposeLU(matrix, lu, permutation, sign))
+			{
+				return false;
+			}
+
+			for (size_t col = 0; col < SIZE; ++col)
+			{
+				auto unit = typename Matrix<T, SIZE>::RowType();
+				unit[col] = T(1);
+
+				const auto x = SolveLU(lu, permutation, unit);
+				for (size_t row = 0; row < SIZE; ++row)
+				{
+					outInverse.At(row, col) = x[row];
+				}
+			}
+
+			return true;
+		}
+		else
+		{
+			const T det = Determinant(matrix);
+			if (det == T(0))
+			{
+				return false;
+			}
+
+			outInverse = Divide(Adjoint(matrix), det);
+			return true;
+		}
+	}
+
+	// Returns a zero matrix if the matrix is singular.
 	template<class T, size_t SIZE>
 	Matrix<T, SIZE> Inverse(const Matrix<T, SIZE>& matrix)
 	{
-		auto adj = Adjoint(matrix);
-		const T det = Determinant(matrix);
+		auto result = Matrix<T, SIZE>();
+		Inverse(matrix, result);
 
-		return Divide(adj, det);
+		return result;
 	}
 
 	template<class T, size_t SIZE>
@@ -251,8 +636,156 @@ namespace ABMath
 		return AreEqual(Multiply<T, SIZE>(mT, matrix), identity, epsilon);
 	}
 
+	// The inverse of an orthogonal matrix is its transpose. The result is meaningless for other matrices.
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> InverseOrthonormal(const Matrix<T, SIZE>& matrix)
+	{
+		auto result = matrix;
+		Transpose(result);
+
+		return result;
+	}
+
+	// True if the last column is exactly (0, 0, 0, 1), so the matrix is a linear part plus a translation row.
 	template<class T>
-	void SetTranslation(Matrix<T, 4>& matrix, const T& x, const T& y, const T& z)
+	constexpr bool IsAffine(const Matrix<T, 4>& matrix)
+	{
+		return matrix.At(0, 3) == T(0) && matrix.At(1, 3) == T(0) && matrix.At(2, 3) == T(0) && matrix.At(3, 3) == T(1);
+	}
+
+	namespace Detail
+	{
+		// Same answer as IsOrthogonal without building the transpose and the full product. Most other matrices fail
+		// on the length of the first row alone; otherwise the upper triangle of matrix * transpose is computed
+		// unrolled and compared once.
+		template<class T, size_t SIZE>
+		bool HasOrthonormalRows(const Matrix<T, SIZE>& matrix, const T epsilon)
+		{
+			auto firstRowLength2 = T(0);
+			ForEachIndex<SIZE>([&firstRowLength2, &matrix](const size_t col)
+			{
+				firstRowLength2 += matrix.At(0, col) * matrix.At(0, col);
+			});
+			if (!(std::abs(firstRowLength2 - T(1)) < epsilon))
+			{
+				return false;
+			}
+
+			auto maxDifference = T(0);
+			ForEach(matrix, [&maxDifference, &matrix](const size_t row, const size_t other)
+			{
+				if (other >= row)
+				{
+					auto dot = T(0);
+					ForEachIndex<SIZE>([&dot, &matrix, row, other](const size_t col)
+					{
+						dot += matrix.At(row, col) * matrix.At(other, col);
+					});
+
+					maxDifference = std::max(maxDifference, std::abs(dot - (row == other ? T(1) : T(0))));
+				}
+			});
+
+			return maxDifference < epsilon;
+		}
+
+		template<class T>
+		Matrix<T, 3> GetLinearPart(const Matrix<T, 4>& matrix)
+		{
+			auto result = Matrix<T, 3>();
+			ForEach(result, [&result, &matrix](const size_t row, const size_t col)
+			{
+				result.At(row, col) = matrix.At(row, col);
+			});
+
+			return result;
+		}
+
+		// Writes the inverse of an affine matrix given the inverse of its linear part: the translation
+		// row is negated and turned back by it.
+		template<class T>
+		void SetAffineInverse(const Matrix<T, 4>& matrix, const Matrix<T, 3>& linearInverse, Matrix<T, 4>& outInverse)
+		{
+			outInverse = Matrix<T, 4>::Identity();
+			ForEach(linearInverse, [&outInverse, &linearInverse](const size_t row, const size_t col)
+			{
+				outInverse.At(row, col) = linearInverse.At(row, col);
+			});
+
+			ForEachIndex<3>([&outInverse, &matrix, &linearInverse](const size_t col)
+			{
+				outInverse.At(3, col) = -(matrix.At(3, 0) * linearInverse.At(0, col) + matrix.At(3, 1) * linearInverse.At(1, col) + matrix.At(3, 2) * linearInverse.At(2, col));
+			});
+		}
+	}
+
+	// For an affine matrix, see IsAffine: inverts only the 3x3 linear part. Returns false and leaves outInverse
+	// untouched if the linear part is singular.
+	template<class T>
+	bool InverseAffine(const Matrix<T, 4>& matrix, Matrix<T, 4>& outInverse)
+	{
+		auto linearInverse = Matrix<T, 3>();
+		if (!Inverse(Detail::GetLinearPart(matrix), linearInverse))
+		{
+			return false;
+		}
+
+		Detail::SetAffineInverse(matrix, linearInverse, outInverse);
+		return true;
+	}
+
+	// Returns a zero matrix if the linear part is singular.
+	template<class T>
+	Matrix<T, 4> InverseAffine(const Matrix<T, 4>& matrix)
+	{
+		auto result = Matrix<T, 4>();
+		InverseAffine(matrix, result);
+
+		return result;
+	}
+
+	// Picks the cheapest inverse the structure allows: a transpose for orthogonal matrices, and for affine 4x4
+	// matrices a transposed or inverted 3x3 linear part. Falls back to Inverse. epsilon is the per-element tolerance
+	// of the orthogonality check. Returns false and leaves outInverse untouched if the matrix is singular.
+	template<class T, size_t SIZE>
+	bool InverseAuto(const Matrix<T, SIZE>& matrix, Matrix<T, SIZE>& outInverse, const T epsilon = std::numeric_limits<T>::epsilon() * T(16))
+	{
+		if constexpr (SIZE == 4)
+		{
+			if (IsAffine(matrix))
+			{
+				const Matrix<T, 3> linear = Detail::GetLinearPart(matrix);
+				if (Detail::HasOrthonormalRows(linear, epsilon))
+				{
+					Detail::SetAffineInverse(matrix, InverseOrthonormal(linear), outInverse);
+					return true;
+				}
+
+				return InverseAffine(matrix, outInverse);
+			}
+		}
+
+		if (Detail::HasOrthonormalRows(matrix, epsilon))
+		{
+			outInverse = InverseOrthonormal(matrix);
+			return true;
+		}
+
+		return Inverse(matrix, outInverse);
+	}
+
+	// Returns a zero matrix if the matrix is singular.
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> InverseAuto(const Matrix<T, SIZE>& matrix, const T epsilon = std::numeric_limits<T>::epsilon() * T(16))
+	{
+		auto result = Matrix<T, SIZE>();
+		InverseAuto(matrix, result, epsilon);
+
+		return result;
+	}
+
+	template<class T>
+	constexpr void SetTranslation(Matrix<T, 4>& matrix, const T& x, const T& y, const T& z)
 	{
 		matrix.At(3, 0) = x;
 		matrix.At(3, 1) = y;
@@ -260,7 +793,7 @@ namespace ABMath
 	}
 
 	template<class T>
-	Matrix<T, 4> CreateTranslation(const T& x, const T& y, const T& z)
+	constexpr Matrix<T, 4> CreateTranslation(const T& x, const T& y, const T& z)
 	{
 		auto matrix = Matrix<T, 4>::Identity();
 		SetTranslation(matrix, x, y, z);
@@ -272,15 +805,19 @@ namespace ABMath
 	{
 		if (SIZE > 2)
 		{
+			const SinCosPair sinCos = SinCos(angle);
+			const T cos = sinCos.cosine;
+			const T sin = sinCos.sine;
+
 			matrix.At(0, 0) = T(1);
 			matrix.At(0, 1) = T(0);
 			matrix.At(0, 2) = T(0);
 			matrix.At(1, 0) = T(0);
-			matrix.At(1, 1) = std::cos(angle.GetRadians());
-			matrix.At(1, 2) = std::sin(angle.GetRadians());
+			matrix.At(1, 1) = cos;
+			matrix.At(1, 2) = sin;
 			matrix.At(2, 0) = T(0);
-			matrix.At(2, 1) = -std::sin(angle.GetRadians());
-			matrix.At(2, 2) = std::cos(angle.GetRadians());
+			matrix.At(2, 1) = -sin;
+			matrix.At(2, 2) = cos;
 		}
 	}
 
@@ -289,15 +826,19 @@ namespace ABMath
 	{
 		if (SIZE > 2)
 		{
-			matrix.At(0, 0) = std::cos(angle.GetRadians());
+			const SinCosPair sinCos = SinCos(angle);
+			const T cos = sinCos.cosine;
+			const T sin = sinCos.sine;
+
+			matrix.At(0, 0) = cos;
 			matrix.At(0, 1) = T(0);
-			matrix.At(0, 2) = -std::sin(angle.GetRadians());
+			matrix.At(0, 2) = -sin;
 			matrix.At(1, 0) = T(0);
 			matrix.At(1, 1) = T(1);
 			matrix.At(1, 2) = T(0);
-			matrix.At(2, 0) = std::sin(angle.GetRadians());
+			matrix.At(2, 0) = sin;
 			matrix.At(2, 1) = T(0);
-			matrix.At(2, 2) = std::cos(angle.GetRadians());
+			matrix.At(2, 2) = cos;
 		}
 	}
 
@@ -306,11 +847,15 @@ namespace ABMath
 	{
 		if (SIZE > 2)
 		{
-			matrix.At(0, 0) = std::cos(angle.GetRadians());
-			matrix.At(0, 1) = std::sin(angle.GetRadians());
+			const SinCosPair sinCos = SinCos(angle);
+			const T cos = sinCos.cosine;
+			const T sin = sinCos.sine;
+
+			matrix.At(0, 0) = cos;
+			matrix.At(0, 1) = sin;
 			matrix.At(0, 2) = T(0);
-			matrix.At(1, 0) = -std::sin(angle.GetRadians());
-			matrix.At(1, 1) = std::cos(angle.GetRadians());
+			matrix.At(1, 0) = -sin;
+			matrix.At(1, 1) = cos;
 			matrix.At(1, 2) = T(0);
 			matrix.At(2, 0) = T(0);
 			matrix.At(2, 1) = T(0);
@@ -318,6 +863,35 @@ namespace ABMath
 		}
 	}
 
+	// Writes the heading-pitch-bank rotation CreateRotationZ(bank) * CreateRotationX(pitch) * CreateRotationY(heading)
+	// directly, with one sine and cosine per angle. MatrixToEulerAngles recovers the angles from it.
+	template<class T, size_t SIZE>
+	void SetRotation(Matrix<T, SIZE>& matrix, const EulerAngles& eulerAngles)
+	{
+		if (SIZE > 2)
+		{
+			const SinCosPair heading = SinCos(eulerAngles.GetHeading());
+			const SinCosPair pitch = SinCos(eulerAngles.GetPitch());
+			const SinCosPair bank = SinCos(eulerAngles.GetBank());
+			const T ch = heading.cosine;
+			const T sh = heading.sine;
+			const T cp = pitch.cosine;
+			const T sp = pitch.sine;
+			const T cb = bank.cosine;
+			const T sb = bank.sine;
+
+			matrix.At(0, 0) = ch*cb + sh*sp*sb;
+			matrix.At(0, 1) = sb*cp;
+			matrix.At(0, 2) = -sh*cb + ch*sp*sb;
+			matrix.At(1, 0) = -ch*sb + sh*sp*cb;
+			matrix.At(1, 1) = cb*cp;
+			matrix.At(1, 2) = sb*sh + ch*sp*cb;
+			matrix.At(2, 0) = sh*cp;
+			matrix.At(2, 1) = -sp;
+			matrix.At(2, 2) = ch*cp;
+		}
+	}
+
 	template<class T, size_t SIZE>
 	Matrix<T, SIZE> CreateRotationX(const Angle& angle)
 	{
@@ -326,6 +900,14 @@ namespace ABMath
 		return matrix;
 	}
 
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> CreateRotationY(const Angle& angle)
+	{
+		auto matrix = Matrix<T, SIZE>::Identity();
+		SetRotationY(matrix, angle);
+		return matrix;
+	}
+
 	template<class T, size_t SIZE>
 	Matrix<T, SIZE> CreateRotationZ(const Angle& angle)
 	{
@@ -334,6 +916,14 @@ namespace ABMath
 		return matrix;
 	}
 
+	template<class T, size_t SIZE>
+	Matrix<T, SIZE> CreateRotation(const EulerAngles& eulerAngles)
+	{
+		auto matrix = Matrix<T, SIZE>::Identity();
+		SetRotation(matrix, eulerAngles);
+		return matrix;
+	}
+
 	template<class T>
 	void SetPerspectiveProjectionX(Matrix<T, 4>& matrix, const T& x)
 	{
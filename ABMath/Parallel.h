@@ -0,0 +1,46 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ABMath
+{
+	constexpr size_t MIN_PARALLEL_CHUNK_SIZE = size_t(1) << 16;
+
+	// Splits [0, count) into contiguous chunks and calls func(begin, end) for each one on its own thread.
+	// Ranges shorter than two chunks run inline on the calling thread.
+	template<class Func>
+	void ParallelFor(const size_t count, Func&& func)
+	{
+		const size_t hardwareThreadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+		const size_t threadCount = std::min(hardwareThreadCount, count / MIN_PARALLEL_CHUNK_SIZE);
+		if (threadCount <= 1)
+		{
+			func(size_t(0), count);
+			return;
+		}
+
+		const size_t chunkSize = (count + threadCount - 1) / threadCount;
+
+		auto workers = std::vector<std::thread>();
+		workers.reserve(threadCount - 1);
+		for (size_t thread = 1; thread < threadCount; ++thread)
+		{
+			const size_t begin = thread * chunkSize;
+			const size_t end = std::min(count, begin + chunkSize);
+			workers.emplace_back([&func, begin, end]()
+			{
+				func(begin, end);
+			});
+		}
+
+		func(size_t(0), std::min(count, chunkSize));
+
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+	}
+}
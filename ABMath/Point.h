@@ -15,7 +15,7 @@ namespace ABMath
 
 	public:
 		Point(const T& x, const T& y, const T& z)
-			: _vector(typename Vector<T, SIZE>::DataType({ x, y, z }))
+			: _vector({ x, y, z })
 		{
 			static_assert(SIZE > 0);
 		}
@@ -62,7 +62,7 @@ namespace ABMath
 
 		Vector<T, SIZE> Subtract(const Point<T, SIZE>& other) const
 		{
-			auto vecData = typename Vector<T, SIZE>::DataType(SIZE);
+			auto vecData = typename Vector<T, SIZE>::DataType();
 			for (size_t i = 0; i < SIZE; ++i)
 			{
 				vecData[i] = _vector.At(i) - other._vector.At(i);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <string>
 
 #include "Angle.h"
@@ -175,161 +176,133 @@ namespace ABMath
 		ClassicPolarVector3<T> _classicVector3;
 	};
 
-	template<class T>
-	void ToCanonicalForm(PolarVector2<T>& polarVector)
+	namespace Detail
 	{
-		const T length = polarVector.GetLength();
-		if (length == T(0))
+		// Maps an angle outside [-pi, pi] into [-pi, pi) and leaves the others untouched.
+		inline Angle WrapPolarAngle(const Angle& angle)
 		{
-			polarVector.SetAngle(Angle::CreateWithRadians(0.f));
+			const Angle pi = Angle::CreatePi();
+			const Angle twoPi = Angle::CreateTwoPi();
+
+			Angle wrapped = angle + pi;
+			wrapped -= std::floor((wrapped / twoPi).GetRadians()) * twoPi;
+			wrapped -= pi;
+
+			return GetAbsolute(angle) > pi ? wrapped : angle;
 		}
-		else
+
+		// Folds a vertical angle outside [-pi/2, pi/2] back into it. outFlipsHorizontal tells whether the
+		// horizontal angle has to turn by pi to point the same way.
+		inline Angle FoldVerticalAngle(const Angle& angle, bool& outFlipsHorizontal)
 		{
 			const Angle pi = Angle::CreatePi();
-			Angle angle = polarVector.GetAngle();
+			const Angle twoPi = 2.f * pi;
+			const Angle piOverTwo = pi / 2.f;
+
+			Angle turned = angle + piOverTwo;
+			turned -= std::floor((turned / twoPi).GetRadians()) * twoPi;
 
-			if (length < T(0))
-			{
-				polarVector.SetLength(-length);
-				angle += pi;
-			}
-			
-			if (GetAbsolute(angle) > pi)
-			{
-				angle += pi;
+			const bool isPastPi = turned > pi;
+			const Angle folded = (isPastPi ? 3.f * piOverTwo - turned : turned - piOverTwo) - piOverTwo;
 
-				const Angle twoPi = Angle::CreateTwoPi();
-				angle -= std::floor((angle / twoPi).GetRadians()) * twoPi;
+			const bool isOutOfRange = GetAbsolute(angle) > piOverTwo;
+			outFlipsHorizontal = isOutOfRange && isPastPi;
+			return isOutOfRange ? folded : angle;
+		}
+
+		// The canonicalization kernels below compute every case and select the result. The four-lane kernels behind
+		// CanonicalizeMany repeat their float operations in order with SIMD selects, so both agree bit for bit.
+		template<class T>
+		void CanonicalizePolarVector2(T& length, Angle& angle)
+		{
+			const bool isZero = length == T(0);
+			const bool isNegative = length < T(0);
 
-				angle -= pi;
-			}
+			const Angle turned = isNegative ? angle + Angle::CreatePi() : angle;
 
-			polarVector.SetAngle(angle);
+			length = isNegative ? -length : length;
+			angle = isZero ? Angle::Zero() : WrapPolarAngle(turned);
 		}
-	}
 
-	template<class T>
-	void ToCanonicalForm(ClassicPolarVector3<T>& polarVector)
-	{
-		const T length = polarVector.GetLength();
-		if (length == T(0))
+		template<class T>
+		void CanonicalizeClassicPolarVector3(T& length, Angle& horAngle, Angle& vertAngle)
 		{
-			const Angle zero = Angle::CreateWithRadians(0.f);
-			polarVector.SetHorizontalAngle(zero);
-			polarVector.SetVerticalAngle(zero);
+			const Angle pi = Angle::CreatePi();
+
+			const bool isZero = length == T(0);
+			const bool isNegative = length < T(0);
+
+			Angle turnedHorAngle = isNegative ? horAngle + pi : horAngle;
+			bool flipsHorizontal = false;
+			const Angle foldedVertAngle = FoldVerticalAngle(isNegative ? -vertAngle : vertAngle, flipsHorizontal);
+			turnedHorAngle = flipsHorizontal ? turnedHorAngle + pi : turnedHorAngle;
+
+			const bool isOnAxis = GetAbsolute(foldedVertAngle).GetRadians() <= 0.0001f;
+			const Angle wrappedHorAngle = isOnAxis ? Angle::Zero() : WrapPolarAngle(turnedHorAngle);
+
+			length = isNegative ? -length : length;
+			horAngle = isZero ? Angle::Zero() : wrappedHorAngle;
+			vertAngle = isZero ? Angle::Zero() : foldedVertAngle;
 		}
-		else
+
+		template<class T>
+		void CanonicalizePolarVector3(T& length, Angle& heading, Angle& pitch)
 		{
 			const Angle pi = Angle::CreatePi();
-			const Angle twoPi = 2.f * pi;
 			const Angle piOverTwo = pi / 2.f;
 
-			Angle horAngle = polarVector.GetHorizontalAngle();
-			Angle vertAngle = polarVector.GetVerticalAngle();
-
-			if (length < T(0))
-			{
-				polarVector.SetLength(-length);
-				horAngle += pi;
-				vertAngle = -vertAngle;
-			}
-
-			if (GetAbsolute(vertAngle) > piOverTwo)
-			{
-				vertAngle += piOverTwo;
-
-				vertAngle -= std::floor((vertAngle / twoPi).GetRadians()) * twoPi;
-				if (vertAngle > pi)
-				{
-					horAngle += pi;
-					vertAngle = 3.f * piOverTwo - vertAngle;
-				}
-				else
-				{
-					vertAngle -= piOverTwo;
-				}
-
-				vertAngle -= piOverTwo;
-			}
-
-			if (GetAbsolute(vertAngle).GetRadians() <= 0.0001f)
-			{
-				horAngle = Angle::CreateWithRadians(0.f);
-			}
-			else if (GetAbsolute(horAngle) > pi)
-			{
-				horAngle += pi;
-
-				horAngle -= std::floor((horAngle / twoPi).GetRadians()) * twoPi;
-
-				horAngle -= pi;
-			}
-
-			polarVector.SetHorizontalAngle(horAngle);
-			polarVector.SetVerticalAngle(vertAngle);
+			const bool isZero = length == T(0);
+			const bool isNegative = length < T(0);
+
+			Angle turnedHeading = isNegative ? heading + pi : heading;
+			bool flipsHeading = false;
+			const Angle foldedPitch = FoldVerticalAngle(isNegative ? -pitch : pitch, flipsHeading);
+			turnedHeading = flipsHeading ? turnedHeading + pi : turnedHeading;
+
+			const bool isVertical = GetAbsolute(foldedPitch) >= piOverTwo * 0.9999f;
+			const Angle wrappedHeading = isVertical ? Angle::Zero() : WrapPolarAngle(turnedHeading);
+
+			length = isNegative ? -length : length;
+			heading = isZero ? Angle::Zero() : wrappedHeading;
+			pitch = isZero ? Angle::Zero() : foldedPitch;
 		}
 	}
 
 	template<class T>
-	void ToCanonicalForm(PolarVector3<T>& polarVector)
+	void ToCanonicalForm(PolarVector2<T>& polarVector)
 	{
-		const T length = polarVector.GetLength();
-		if (length == T(0))
-		{
-			const Angle zero = Angle::CreateWithRadians(0.f);
-			polarVector.SetHeading(zero);
-			polarVector.SetPitch(zero);
-		}
-		else
-		{
-			const Angle pi = Angle::CreatePi();
-			const Angle twoPi = 2.f * pi;
-			const Angle piOverTwo = pi / 2.f;
+		T length = polarVector.GetLength();
+		Angle angle = polarVector.GetAngle();
+		Detail::CanonicalizePolarVector2(length, angle);
 
-			Angle heading = polarVector.GetHeading();
-			Angle pitch = polarVector.GetPitch();
-
-			if (length < T(0))
-			{
-				polarVector.SetLength(-length);
-				heading += pi;
-				pitch = -pitch;
-			}
-
-			if (GetAbsolute(pitch) > piOverTwo)
-			{
-				pitch += piOverTwo;
-
-				pitch -= std::floor((pitch / twoPi).GetRadians()) * twoPi;
-				if (pitch > pi)
-				{
-					heading += pi;
-					pitch = 3.f * piOverTwo - pitch;
-				}
-				else
-				{
-					pitch -= piOverTwo;
-				}
-
-				pitch -= piOverTwo;
-			}
-
-			if (GetAbsolute(pitch) >= piOverTwo * 0.9999f)
-			{
-				heading = Angle::CreateWithRadians(0.f);
-			}
-			else if (GetAbsolute(heading) > pi)
-			{
-				heading += pi;
-
-				heading -= std::floor((heading / twoPi).GetRadians()) * twoPi;
-
-				heading -= pi;
-			}
-
-			polarVector.SetHeading(heading);
-			polarVector.SetPitch(pitch);
-		}
+		polarVector.SetLength(length);
+		polarVector.SetAngle(angle);
+	}
+
+	template<class T>
+	void ToCanonicalForm(ClassicPolarVector3<T>& polarVector)
+	{
+		T length = polarVector.GetLength();
+		Angle horAngle = polarVector.GetHorizontalAngle();
+		Angle vertAngle = polarVector.GetVerticalAngle();
+		Detail::CanonicalizeClassicPolarVector3(length, horAngle, vertAngle);
+
+		polarVector.SetLength(length);
+		polarVector.SetHorizontalAngle(horAngle);
+		polarVector.SetVerticalAngle(vertAngle);
+	}
+
+	template<class T>
+	void ToCanonicalForm(PolarVector3<T>& polarVector)
+	{
+		T length = polarVector.GetLength();
+		Angle heading = polarVector.GetHeading();
+		Angle pitch = polarVector.GetPitch();
+		Detail::CanonicalizePolarVector3(length, heading, pitch);
+
+		polarVector.SetLength(length);
+		polarVector.SetHeading(heading);
+		polarVector.SetPitch(pitch);
 	}
 
 	template<class T>
@@ -1,40 +1,14 @@
 #include "Quaternion.h"
 
 #include <cmath>
+#include <limits>
 #include <sstream>
 
 #include "Float.h"
-#include "Vector.h"
+#include "Trigonometry.h"
 
 namespace ABMath
 {
-	Quaternion::Quaternion(const float w, const float x, const float y, const float z)
-		: _w(w)
-		, _x(x)
-		, _y(y)
-		, _z(z)
-	{}
-
-	float Quaternion::GetW() const
-	{
-		return _w;
-	}
-
-	float Quaternion::GetX() const
-	{
-		return _x;
-	}
-
-	float Quaternion::GetY() const
-	{
-		return _y;
-	}
-
-	float Quaternion::GetZ() const
-	{
-		return _z;
-	}
-
 	void Quaternion::Conjugate()
 	{
 		_x = -_x;
@@ -59,9 +33,10 @@ namespace ABMath
 			const float alpha = std::acos(_w);
 			const float newAlpha = alpha * exponent;
 			
-			_w = std::cos(newAlpha);
+			const SinCosPair newAlphaSinCos = SinCos(newAlpha);
+			_w = newAlphaSinCos.cosine;
 
-			const float multiplier = std::sin(newAlpha) / std::sin(alpha);
+			const float multiplier = newAlphaSinCos.sine / std::sin(alpha);
 			_x *= multiplier;
 			_y *= multiplier;
 			_z *= multiplier;
@@ -106,26 +81,120 @@ namespace ABMath
 			+ left.GetZ() * right.GetZ();
 	}
 
-	Quaternion Multiply(const Quaternion& left, const Quaternion& right)
+	Quaternion Subtract(const Quaternion& left, Quaternion right)
 	{
-		const auto leftW = left.GetW();
-		const auto rightW = right.GetW();
-		const auto leftVector = FVector3({ left.GetX(), left.GetY(), left.GetZ() });
-		const auto rightVector = FVector3({ right.GetX(), right.GetY(), right.GetZ() });
-		
-		const auto w = leftW * rightW - DotProduct(leftVector, rightVector);
+		right.Inverse();
+		return Multiply(left, right);
+	}
 
-		auto vector = Multiply(rightVector, leftW);
-		Add(vector, Multiply(leftVector, rightW));
-		Add(vector, CrossProduct(leftVector, rightVector));
+	namespace
+	{
+		Quaternion Blend(const Quaternion& left, const float leftWeight, const Quaternion& right, const float rightWeight)
+		{
+			return Quaternion(
+				left.GetW() * leftWeight + right.GetW() * rightWeight,
+				left.GetX() * leftWeight + right.GetX() * rightWeight,
+				left.GetY() * leftWeight + right.GetY() * rightWeight,
+				left.GetZ() * leftWeight + right.GetZ() * rightWeight);
+		}
+
+		Quaternion CreateNormalized(const Quaternion& quaternion)
+		{
+			const float scale = 1.f / Magnitude(quaternion);
+			return Blend(quaternion, scale, quaternion, 0.f);
+		}
 
-		return Quaternion(w, vector.At(0), vector.At(1), vector.At(2));
+		// sin(weight * angle) / sin(angle) as a series in (cos(angle) - 1), truncated after twelve terms with
+		// the last one scaled to compensate for the remainder (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP").
+		// The truncation error is below 7.2e-7 for weight and cosAngle in [0, 1].
+		float CalculateFastSlerpWeight(const float weight, const float cosAngle)
+		{
+			constexpr int TERM_COUNT = 12;
+			constexpr float LAST_TERM_CORRECTION = 1.8937f;
+
+			const float weightSquared = weight * weight;
+			const float cosAngleMinusOne = cosAngle - 1.f;
+
+			float term = weight;
+			float result = weight;
+			for (int i = 1; i <= TERM_COUNT; ++i)
+			{
+				const float u = 1.f / float(i * (2 * i + 1));
+				const float v = float(i) / float(2 * i + 1);
+				float factor = (u * weightSquared - v) * cosAngleMinusOne;
+				if (i == TERM_COUNT)
+				{
+					factor *= LAST_TERM_CORRECTION;
+				}
+
+				term *= factor;
+				result += term;
+			}
+
+			return result;
+		}
 	}
 
-	Quaternion Subtract(const Quaternion& left, Quaternion right)
+	Quaternion Slerp(const Quaternion& left, const Quaternion& right, const float weight)
 	{
-		right.Inverse();
-		return Multiply(left, right);
+		float cosAngle = DotProduct(left, right);
+		const float rightSign = (cosAngle < 0.f) ? -1.f : 1.f;
+		cosAngle *= rightSign;
+
+		if (cosAngle > 1.f - std::numeric_limits<float>::epsilon())
+		{
+			return Nlerp(left, right, weight);
+		}
+
+		const float angle = std::acos(cosAngle);
+		const float invSinAngle = 1.f / std::sin(angle);
+		const float leftWeight = std::sin((1.f - weight) * angle) * invSinAngle;
+		const float rightWeight = std::sin(weight * angle) * invSinAngle;
+
+		return Blend(left, leftWeight, right, rightWeight * rightSign);
+	}
+
+	Quaternion Nlerp(const Quaternion& left, const Quaternion& right, const float weight)
+	{
+		const float rightSign = (DotProduct(left, right) < 0.f) ? -1.f : 1.f;
+
+		return CreateNormalized(Blend(left, 1.f - weight, right, weight * rightSign));
+	}
+
+	Quaternion FastSlerp(const Quaternion& left, const Quaternion& right, const float weight)
+	{
+		const float cosAngle = DotProduct(left, right);
+		const float rightSign = std::copysign(1.f, cosAngle);
+		const float absCosAngle = std::fabs(cosAngle);
+
+		const float leftWeight = CalculateFastSlerpWeight(1.f - weight, absCosAngle);
+		const float rightWeight = CalculateFastSlerpWeight(weight, absCosAngle);
+
+		return Blend(left, leftWeight, right, rightWeight * rightSign);
+	}
+
+	void Slerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			outResults[i] = Slerp(lefts[i], rights[i], weights[i]);
+		}
+	}
+
+	void Nlerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			outResults[i] = Nlerp(lefts[i], rights[i], weights[i]);
+		}
+	}
+
+	void FastSlerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			outResults[i] = FastSlerp(lefts[i], rights[i], weights[i]);
+		}
 	}
 
 	void Fill(const Quaternion& quaternion, float& w, float& x, float& y, float& z)
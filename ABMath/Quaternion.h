@@ -1,18 +1,41 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
+#include "Simd.h"
+
 namespace ABMath
 {
 	class Quaternion
 	{
 	public:
-		Quaternion(const float w, const float x, const float y, const float z);
+		Quaternion(const float w, const float x, const float y, const float z)
+			: _w(w)
+			, _x(x)
+			, _y(y)
+			, _z(z)
+		{}
+
+		float GetW() const
+		{
+			return _w;
+		}
+
+		float GetX() const
+		{
+			return _x;
+		}
+
+		float GetY() const
+		{
+			return _y;
+		}
 
-		float GetW() const;
-		float GetX() const;
-		float GetY() const;
-		float GetZ() const;
+		float GetZ() const
+		{
+			return _z;
+		}
 
 		void Conjugate();
 		void Inverse();
@@ -33,9 +56,56 @@ namespace ABMath
 	Quaternion CreateExponentiated(const Quaternion& quaternion, const float exponent);
 
 	float DotProduct(const Quaternion& left, const Quaternion& right);
-	Quaternion Multiply(const Quaternion& left, const Quaternion& right);
+
+	inline Quaternion Multiply(const Quaternion& left, const Quaternion& right)
+	{
+		const float lw = left.GetW();
+		const float lx = left.GetX();
+		const float ly = left.GetY();
+		const float lz = left.GetZ();
+
+		if constexpr (Simd::IS_ENABLED)
+		{
+			// Lanes hold [w, x, y, z]; each left component scales a signed permutation of right.
+			const auto r = Simd::Set(right.GetW(), right.GetX(), right.GetY(), right.GetZ());
+
+			auto sum = Simd::Multiply(Simd::Splat(lw), r);
+			sum = Simd::MultiplyAdd(Simd::Splat(lx), Simd::Multiply(Simd::Shuffle<1, 0, 3, 2>(r), Simd::Set(-1.f, 1.f, -1.f, 1.f)), sum);
+			sum = Simd::MultiplyAdd(Simd::Splat(ly), Simd::Multiply(Simd::Shuffle<2, 3, 0, 1>(r), Simd::Set(-1.f, 1.f, 1.f, -1.f)), sum);
+			sum = Simd::MultiplyAdd(Simd::Splat(lz), Simd::Multiply(Simd::Shuffle<3, 2, 1, 0>(r), Simd::Set(-1.f, -1.f, 1.f, 1.f)), sum);
+
+			float result[4];
+			Simd::Store4(result, sum);
+
+			return Quaternion(result[0], result[1], result[2], result[3]);
+		}
+		else
+		{
+			const float rw = right.GetW();
+			const float rx = right.GetX();
+			const float ry = right.GetY();
+			const float rz = right.GetZ();
+
+			return Quaternion(
+				lw * rw - lx * rx - ly * ry - lz * rz,
+				lw * rx + lx * rw + ly * rz - lz * ry,
+				lw * ry - lx * rz + ly * rw + lz * rx,
+				lw * rz + lx * ry - ly * rx + lz * rw);
+		}
+	}
+
 	Quaternion Subtract(const Quaternion& left, Quaternion right);
 
+	// Interpolate along the shorter arc between unit quaternions, weight 0 gives left and 1 gives right.
+	Quaternion Slerp(const Quaternion& left, const Quaternion& right, const float weight);
+	Quaternion Nlerp(const Quaternion& left, const Quaternion& right, const float weight);
+	// Polynomial approximation of Slerp without trigonometry, max component error below 1.5e-6 for weights in [0, 1].
+	Quaternion FastSlerp(const Quaternion& left, const Quaternion& right, const float weight);
+
+	void Slerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults);
+	void Nlerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults);
+	void FastSlerp(const Quaternion* lefts, const Quaternion* rights, const float* weights, const size_t count, Quaternion* outResults);
+
 	void Fill(const Quaternion& quaternion, float& w, float& x, float& y, float& z);
 
 	std::string ToString(const Quaternion& quaternion);
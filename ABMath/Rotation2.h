@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "Angle.h"
+#include "Trigonometry.h"
+#include "Vector.h"
+#include "VectorArray.h"
+
+namespace ABMath
+{
+	// A 2D rotation stored as the cosine and sine of its angle, the unit complex number cos + i * sin.
+	// It rotates counter-clockwise like CreateRotationZ, and composes by complex multiplication.
+	template<class T>
+	class Rotation2
+	{
+	public:
+		static Rotation2 Identity()
+		{
+			return Rotation2(T(1), T(0));
+		}
+
+	public:
+		explicit Rotation2(const Angle& angle)
+			: Rotation2(SinCos(angle))
+		{}
+
+		Rotation2(const T& cosine, const T& sine)
+			: _cosine(cosine)
+			, _sine(sine)
+		{}
+
+		T GetCosine() const
+		{
+			return _cosine;
+		}
+
+		T GetSine() const
+		{
+			return _sine;
+		}
+
+		Angle GetAngle() const
+		{
+			return Angle::CreateWithRadians(std::atan2(static_cast<float>(_sine), static_cast<float>(_cosine)));
+		}
+
+		void Inverse()
+		{
+			_sine = -_sine;
+		}
+
+	private:
+		explicit Rotation2(const SinCosPair& sinCos)
+			: _cosine(static_cast<T>(sinCos.cosine))
+			, _sine(static_cast<T>(sinCos.sine))
+		{}
+
+	private:
+		T _cosine;
+		T _sine;
+	};
+
+	using FRotation2 = Rotation2<float>;
+
+	template<class T>
+	Rotation2<T> CreateInverse(const Rotation2<T>& rotation)
+	{
+		auto result = rotation;
+		result.Inverse();
+		return result;
+	}
+
+	// The rotation by the sum of both angles. 2D rotations commute, so the order does not matter.
+	template<class T>
+	Rotation2<T> Multiply(const Rotation2<T>& left, const Rotation2<T>& right)
+	{
+		const T cosine = left.GetCosine() * right.GetCosine() - left.GetSine() * right.GetSine();
+		const T sine = left.GetSine() * right.GetCosine() + left.GetCosine() * right.GetSine();
+
+		return Rotation2<T>(cosine, sine);
+	}
+
+	template<class T>
+	Vector<T, 2> Rotate(const Rotation2<T>& rotation, const Vector<T, 2>& vector)
+	{
+		const T x = vector.At(0);
+		const T y = vector.At(1);
+		const T cosine = rotation.GetCosine();
+		const T sine = rotation.GetSine();
+
+		return Vector<T, 2>({ x * cosine - y * sine, x * sine + y * cosine });
+	}
+
+	// Batched Rotate, outVectors may equal vectors.
+	template<class T>
+	void RotateMany(const Rotation2<T>& rotation, const Vector<T, 2>* vectors, const size_t count, Vector<T, 2>* outVectors)
+	{
+		const T cosine = rotation.GetCosine();
+		const T sine = rotation.GetSine();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const T x = vectors[i].At(0);
+			const T y = vectors[i].At(1);
+			outVectors[i].At(0) = x * cosine - y * sine;
+			outVectors[i].At(1) = x * sine + y * cosine;
+		}
+	}
+
+	template<class T>
+	void RotateMany(const Rotation2<T>& rotation, Vector<T, 2>* inOutVectors, const size_t count)
+	{
+		RotateMany(rotation, inOutVectors, count, inOutVectors);
+	}
+
+	template<class T>
+	void RotateMany(const Rotation2<T>& rotation, const VectorArray<T, 2>& vectors, VectorArray<T, 2>& outVectors)
+	{
+		const size_t count = vectors.GetSize();
+		outVectors.Resize(count);
+
+		const T* xs = vectors.GetLane(0);
+		const T* ys = vectors.GetLane(1);
+		T* outXs = outVectors.GetLane(0);
+		T* outYs = outVectors.GetLane(1);
+
+		const T cosine = rotation.GetCosine();
+		const T sine = rotation.GetSine();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const T x = xs[i];
+			const T y = ys[i];
+			outXs[i] = x * cosine - y * sine;
+			outYs[i] = x * sine + y * cosine;
+		}
+	}
+
+	template<class T>
+	void RotateMany(const Rotation2<T>& rotation, VectorArray<T, 2>& inOutVectors)
+	{
+		RotateMany(rotation, inOutVectors, inOutVectors);
+	}
+}
@@ -0,0 +1,480 @@
+#pragma once
+
+#include <cstddef>
+
+#if !defined(ABMATH_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ABMATH_SIMD_SSE
+#endif
+
+#if defined(ABMATH_SIMD_SSE) && (defined(__FMA__) || defined(__AVX2__))
+#define ABMATH_SIMD_FMA
+#endif
+
+#if defined(ABMATH_SIMD_SSE)
+#include <immintrin.h>
+#else
+#include <cmath>
+#endif
+
+namespace ABMath
+{
+	namespace Simd
+	{
+#if defined(ABMATH_SIMD_SSE)
+		constexpr bool IS_ENABLED = true;
+
+		using Float4 = __m128;
+
+		inline Float4 Load4(const float* data)
+		{
+			return _mm_loadu_ps(data);
+		}
+
+		// Reads exactly three floats, the fourth lane is zero.
+		inline Float4 Load3(const float* data)
+		{
+			const __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(data));
+			const __m128 z = _mm_load_ss(data + 2);
+			return _mm_movelh_ps(xy, z);
+		}
+
+		inline void Store4(float* data, const Float4 value)
+		{
+			_mm_storeu_ps(data, value);
+		}
+
+		// Writes exactly three floats.
+		inline void Store3(float* data, const Float4 value)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(data), value);
+			_mm_store_ss(data + 2, _mm_movehl_ps(value, value));
+		}
+
+		inline Float4 Splat(const float value)
+		{
+			return _mm_set1_ps(value);
+		}
+
+		inline Float4 Set(const float x, const float y, const float z, const float w)
+		{
+			return _mm_setr_ps(x, y, z, w);
+		}
+
+		// Result lane i is lane Ii of value.
+		template<int I0, int I1, int I2, int I3>
+		Float4 Shuffle(const Float4 value)
+		{
+			return _mm_shuffle_ps(value, value, _MM_SHUFFLE(I3, I2, I1, I0));
+		}
+
+		inline Float4 Add(const Float4 left, const Float4 right)
+		{
+			return _mm_add_ps(left, right);
+		}
+
+		inline Float4 Subtract(const Float4 left, const Float4 right)
+		{
+			return _mm_sub_ps(left, right);
+		}
+
+		inline Float4 Multiply(const Float4 left, const Float4 right)
+		{
+			return _mm_mul_ps(left, right);
+		}
+
+		// left * right + addend, fused when FMA is available.
+		inline Float4 MultiplyAdd(const Float4 left, const Float4 right, const Float4 addend)
+		{
+#if defined(ABMATH_SIMD_FMA)
+			return _mm_fmadd_ps(left, right, addend);
+#else
+			return _mm_add_ps(_mm_mul_ps(left, right), addend);
+#endif
+		}
+
+		inline Float4 Divide(const Float4 left, const Float4 right)
+		{
+			return _mm_div_ps(left, right);
+		}
+
+		inline Float4 Min(const Float4 left, const Float4 right)
+		{
+			return _mm_min_ps(left, right);
+		}
+
+		inline Float4 Max(const Float4 left, const Float4 right)
+		{
+			return _mm_max_ps(left, right);
+		}
+
+		inline Float4 Absolute(const Float4 value)
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.f), value);
+		}
+
+		// Flips the sign bit of every lane, so zero becomes -0 like the scalar unary minus.
+		inline Float4 Negate(const Float4 value)
+		{
+			return _mm_xor_ps(_mm_set1_ps(-0.f), value);
+		}
+
+		// The magnitude of every lane of magnitude with the sign bit of the same lane of sign.
+		inline Float4 CopySign(const Float4 magnitude, const Float4 sign)
+		{
+			const __m128 signMask = _mm_set1_ps(-0.f);
+			return _mm_or_ps(_mm_andnot_ps(signMask, magnitude), _mm_and_ps(signMask, sign));
+		}
+
+		// Rounds every lane to the nearest integer, ties to even. Lanes must be within the int32 range.
+		inline Float4 Round(const Float4 value)
+		{
+			return _mm_cvtepi32_ps(_mm_cvtps_epi32(value));
+		}
+
+		// Per-lane comparison results, consumed by Select.
+		using Mask4 = __m128;
+
+		inline Mask4 Greater(const Float4 left, const Float4 right)
+		{
+			return _mm_cmpgt_ps(left, right);
+		}
+
+		inline Mask4 GreaterOrEqual(const Float4 left, const Float4 right)
+		{
+			return _mm_cmpge_ps(left, right);
+		}
+
+		inline Mask4 Equal(const Float4 left, const Float4 right)
+		{
+			return _mm_cmpeq_ps(left, right);
+		}
+
+		inline Mask4 And(const Mask4 left, const Mask4 right)
+		{
+			return _mm_and_ps(left, right);
+		}
+
+		inline Mask4 Or(const Mask4 left, const Mask4 right)
+		{
+			return _mm_or_ps(left, right);
+		}
+
+		inline bool AreAllTrue(const Mask4 mask)
+		{
+			return _mm_movemask_ps(mask) == 0xF;
+		}
+
+		// True for lanes with the sign bit set, including -0.
+		inline Mask4 HasSignBit(const Float4 value)
+		{
+			return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(value), 31));
+		}
+
+		inline Float4 Select(const Mask4 mask, const Float4 ifTrue, const Float4 ifFalse)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+		}
+
+		// Rounds every lane towards negative infinity, bit for bit like std::floor including the sign of zero.
+		// Lanes of 2^23 and above in magnitude are already whole and pass through, as do infinities and NaN.
+		inline Float4 Floor(const Float4 value)
+		{
+			const __m128 rounded = Round(value);
+			const __m128 floored = Select(Greater(rounded, value), _mm_sub_ps(rounded, _mm_set1_ps(1.f)), rounded);
+			return Select(Greater(_mm_set1_ps(8388608.f), Absolute(value)), CopySign(floored, value), value);
+		}
+
+		// Sums the lanes as ((x + y) + z) + w, the same order as a scalar loop.
+		inline float HorizontalSum(const Float4 value)
+		{
+			const __m128 y = _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m128 z = _mm_movehl_ps(value, value);
+			const __m128 w = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3));
+
+			__m128 sum = _mm_add_ss(value, y);
+			sum = _mm_add_ss(sum, z);
+			sum = _mm_add_ss(sum, w);
+
+			return _mm_cvtss_f32(sum);
+		}
+#else
+		constexpr bool IS_ENABLED = false;
+
+		struct Float4
+		{
+			float lanes[4];
+		};
+
+		inline Float4 Load4(const float* data)
+		{
+			return Float4{ { data[0], data[1], data[2], data[3] } };
+		}
+
+		inline Float4 Load3(const float* data)
+		{
+			return Float4{ { data[0], data[1], data[2], 0.f } };
+		}
+
+		inline void Store4(float* data, const Float4 value)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				data[i] = value.lanes[i];
+			}
+		}
+
+		inline void Store3(float* data, const Float4 value)
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				data[i] = value.lanes[i];
+			}
+		}
+
+		inline Float4 Splat(const float value)
+		{
+			return Float4{ { value, value, value, value } };
+		}
+
+		inline Float4 Set(const float x, const float y, const float z, const float w)
+		{
+			return Float4{ { x, y, z, w } };
+		}
+
+		template<int I0, int I1, int I2, int I3>
+		Float4 Shuffle(const Float4 value)
+		{
+			return Float4{ { value.lanes[I0], value.lanes[I1], value.lanes[I2], value.lanes[I3] } };
+		}
+
+		inline Float4 Add(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] += right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Subtract(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] -= right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Multiply(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] *= right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 MultiplyAdd(const Float4 left, const Float4 right, const Float4 addend)
+		{
+			return Add(Multiply(left, right), addend);
+		}
+
+		inline Float4 Divide(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] /= right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Min(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] < right.lanes[i] ? left.lanes[i] : right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Max(const Float4 left, const Float4 right)
+		{
+			auto result = left;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] > right.lanes[i] ? left.lanes[i] : right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Absolute(const Float4 value)
+		{
+			auto result = value;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = std::fabs(result.lanes[i]);
+			}
+			return result;
+		}
+
+		inline Float4 Negate(const Float4 value)
+		{
+			auto result = value;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = -result.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 CopySign(const Float4 magnitude, const Float4 sign)
+		{
+			auto result = magnitude;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = std::copysign(result.lanes[i], sign.lanes[i]);
+			}
+			return result;
+		}
+
+		inline Float4 Round(const Float4 value)
+		{
+			auto result = value;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = std::nearbyint(result.lanes[i]);
+			}
+			return result;
+		}
+
+		struct Mask4
+		{
+			bool lanes[4];
+		};
+
+		inline Mask4 Greater(const Float4 left, const Float4 right)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] > right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Mask4 GreaterOrEqual(const Float4 left, const Float4 right)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] >= right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Mask4 Equal(const Float4 left, const Float4 right)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] == right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Mask4 And(const Mask4 left, const Mask4 right)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] && right.lanes[i];
+			}
+			return result;
+		}
+
+		inline Mask4 Or(const Mask4 left, const Mask4 right)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = left.lanes[i] || right.lanes[i];
+			}
+			return result;
+		}
+
+		inline bool AreAllTrue(const Mask4 mask)
+		{
+			return mask.lanes[0] && mask.lanes[1] && mask.lanes[2] && mask.lanes[3];
+		}
+
+		inline Mask4 HasSignBit(const Float4 value)
+		{
+			auto result = Mask4();
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = std::signbit(value.lanes[i]);
+			}
+			return result;
+		}
+
+		inline Float4 Select(const Mask4 mask, const Float4 ifTrue, const Float4 ifFalse)
+		{
+			auto result = ifFalse;
+			for (int i = 0; i < 4; ++i)
+			{
+				if (mask.lanes[i])
+					result.lanes[i] = ifTrue.lanes[i];
+			}
+			return result;
+		}
+
+		inline Float4 Floor(const Float4 value)
+		{
+			auto result = value;
+			for (int i = 0; i < 4; ++i)
+			{
+				result.lanes[i] = std::floor(result.lanes[i]);
+			}
+			return result;
+		}
+
+		inline float HorizontalSum(const Float4 value)
+		{
+			return ((value.lanes[0] + value.lanes[1]) + value.lanes[2]) + value.lanes[3];
+		}
+#endif
+
+		template<size_t COUNT>
+		Float4 Load(const float* data)
+		{
+			static_assert(COUNT == 3 || COUNT == 4);
+			if constexpr (COUNT == 4)
+			{
+				return Load4(data);
+			}
+			else
+			{
+				return Load3(data);
+			}
+		}
+
+		template<size_t COUNT>
+		void Store(float* data, const Float4 value)
+		{
+			static_assert(COUNT == 3 || COUNT == 4);
+			if constexpr (COUNT == 4)
+			{
+				Store4(data, value);
+			}
+			else
+			{
+				Store3(data, value);
+			}
+		}
+	}
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "Matrix.h"
+#include "Simd.h"
+#include "Vector.h"
+
+namespace ABMath
+{
+	// An affine 3D transform: the Matrix<T, 4> with (0, 0, 0, 1) as its last column, stored without that column.
+	// Rows 0 to 2 hold the linear part and row 3 the translation, so vectors are rows multiplied from the left
+	// like everywhere else in the library.
+	template<class T>
+	class Transform3 final
+	{
+	public:
+		static constexpr size_t ROW_COUNT = 4;
+		static constexpr size_t COL_COUNT = 3;
+
+		using DataType = std::array<T, ROW_COUNT * COL_COUNT>;
+
+	public:
+		static constexpr Transform3 Identity()
+		{
+			auto result = Transform3();
+
+			for (size_t i = 0; i < COL_COUNT; ++i)
+			{
+				result.At(i, i) = T(1);
+			}
+
+			return result;
+		}
+
+		constexpr Transform3()
+			: _data()
+		{}
+
+		constexpr explicit Transform3(const DataType& data)
+			: _data(data)
+		{}
+
+		Transform3(const Matrix<T, 3>& linear, const Vector<T, 3>& translation)
+			: _data()
+		{
+			for (size_t row = 0; row < COL_COUNT; ++row)
+			{
+				for (size_t col = 0; col < COL_COUNT; ++col)
+				{
+					At(row, col) = linear.At(row, col);
+				}
+			}
+
+			SetTranslation(translation);
+		}
+
+		constexpr const T& At(const size_t row, const size_t col) const
+		{
+			return _data[row * COL_COUNT + col];
+		}
+
+		constexpr T& At(const size_t row, const size_t col)
+		{
+			const auto& constThis = static_cast<const Transform3&>(*this);
+			return const_cast<T&>(constThis.At(row, col));
+		}
+
+		constexpr Matrix<T, 3> GetLinear() const
+		{
+			auto result = Matrix<T, 3>();
+			for (size_t row = 0; row < COL_COUNT; ++row)
+			{
+				for (size_t col = 0; col < COL_COUNT; ++col)
+				{
+					result.At(row, col) = At(row, col);
+				}
+			}
+
+			return result;
+		}
+
+		Vector<T, 3> GetTranslation() const
+		{
+			return Vector<T, 3>({ At(3, 0), At(3, 1), At(3, 2) });
+		}
+
+		void SetTranslation(const Vector<T, 3>& translation)
+		{
+			for (size_t col = 0; col < COL_COUNT; ++col)
+			{
+				At(3, col) = translation.At(col);
+			}
+		}
+
+		const T* GetData() const
+		{
+			return _data.data();
+		}
+
+		T* GetData()
+		{
+			return _data.data();
+		}
+
+	private:
+		alignas(16) DataType _data;
+	};
+
+	using FTransform3 = Transform3<float>;
+
+	static_assert(sizeof(FTransform3) == 12 * sizeof(float));
+	static_assert(std::is_trivially_copyable_v<FTransform3>);
+
+	template<class T>
+	constexpr bool IS_SIMD_TRANSFORM = Simd::IS_ENABLED && std::is_same_v<T, float>;
+
+	// Drops the last column, which must be (0, 0, 0, 1) for the conversion to be lossless.
+	template<class T>
+	constexpr Transform3<T> ToTransform3(const Matrix<T, 4>& matrix)
+	{
+		auto result = Transform3<T>();
+		for (size_t row = 0; row < Transform3<T>::ROW_COUNT; ++row)
+		{
+			for (size_t col = 0; col < Transform3<T>::COL_COUNT; ++col)
+			{
+				result.At(row, col) = matrix.At(row, col);
+			}
+		}
+
+		return result;
+	}
+
+	template<class T>
+	constexpr Matrix<T, 4> ToMatrix4(const Transform3<T>& transform)
+	{
+		auto result = Matrix<T, 4>::Identity();
+		for (size_t row = 0; row < Transform3<T>::ROW_COUNT; ++row)
+		{
+			for (size_t col = 0; col < Transform3<T>::COL_COUNT; ++col)
+			{
+				result.At(row, col) = transform.At(row, col);
+			}
+		}
+
+		return result;
+	}
+
+	// Applies left, then right, like Multiply(ToMatrix4(left), ToMatrix4(right)) but with 36 products instead of 64.
+	template<class T>
+	Transform3<T> Multiply(const Transform3<T>& left, const Transform3<T>& right)
+	{
+		auto result = Transform3<T>();
+
+		if constexpr (IS_SIMD_TRANSFORM<T>)
+		{
+			const Simd::Float4 rightRows[] = {
+				Simd::Load3(right.GetData()),
+				Simd::Load3(right.GetData() + 3),
+				Simd::Load3(right.GetData() + 6)
+			};
+			const Simd::Float4 rightTranslation = Simd::Load3(right.GetData() + 9);
+
+			ForEachIndex<Transform3<T>::ROW_COUNT>([&result, &left, &rightRows, &rightTranslation](const size_t row)
+			{
+				const float* leftRow = left.GetData() + row * 3;
+				auto sum = row == 3 ? rightTranslation : Simd::Splat(0.f);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[0]), rightRows[0], sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[1]), rightRows[1], sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(leftRow[2]), rightRows[2], sum);
+				Simd::Store3(result.GetData() + row * 3, sum);
+			});
+
+			return result;
+		}
+
+		for (size_t row = 0; row < Transform3<T>::ROW_COUNT; ++row)
+		{
+			for (size_t col = 0; col < Transform3<T>::COL_COUNT; ++col)
+			{
+				T sum = row == 3 ? right.At(3, col) : T(0);
+				for (size_t c = 0; c < 3; ++c)
+				{
+					sum += left.At(row, c) * right.At(c, col);
+				}
+				result.At(row, col) = sum;
+			}
+		}
+
+		return result;
+	}
+
+	namespace Detail
+	{
+		template<class T>
+		Vector<T, 3> Transform(const Transform3<T>& transform, const Vector<T, 3>& vector, const bool isPoint)
+		{
+			auto result = Vector<T, 3>::Zero();
+
+			if constexpr (IS_SIMD_TRANSFORM<T>)
+			{
+				const float* data = transform.GetData();
+				auto sum = isPoint ? Simd::Load3(data + 9) : Simd::Splat(0.f);
+				sum = Simd::MultiplyAdd(Simd::Splat(vector.At(0)), Simd::Load3(data), sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(vector.At(1)), Simd::Load3(data + 3), sum);
+				sum = Simd::MultiplyAdd(Simd::Splat(vector.At(2)), Simd::Load3(data + 6), sum);
+				Simd::Store3(result.GetData(), sum);
+
+				return result;
+			}
+
+			for (size_t col = 0; col < 3; ++col)
+			{
+				T sum = isPoint ? transform.At(3, col) : T(0);
+				for (size_t c = 0; c < 3; ++c)
+				{
+					sum += vector.At(c) * transform.At(c, col);
+				}
+				result.At(col) = sum;
+			}
+
+			return result;
+		}
+	}
+
+	template<class T>
+	Vector<T, 3> TransformPoint(const Transform3<T>& transform, const Vector<T, 3>& point)
+	{
+		return Detail::Transform(transform, point, true);
+	}
+
+	// Ignores the translation.
+	template<class T>
+	Vector<T, 3> TransformDirection(const Transform3<T>& transform, const Vector<T, 3>& direction)
+	{
+		return Detail::Transform(transform, direction, false);
+	}
+
+	// For a linear part with orthonormal rows, a rotation optionally combined with a reflection: the transpose of
+	// the linear part and the translation turned back by it. The result is meaningless for other transforms.
+	template<class T>
+	Transform3<T> InverseOrthonormal(const Transform3<T>& transform)
+	{
+		auto result = Transform3<T>();
+		for (size_t row = 0; row < 3; ++row)
+		{
+			for (size_t col = 0; col < 3; ++col)
+			{
+				result.At(row, col) = transform.At(col, row);
+			}
+		}
+
+		for (size_t col = 0; col < 3; ++col)
+		{
+			result.At(3, col) = -(transform.At(3, 0) * result.At(0, col) + transform.At(3, 1) * result.At(1, col) + transform.At(3, 2) * result.At(2, col));
+		}
+
+		return result;
+	}
+
+	// Inverts the linear part with the closed-form 3x3 inverse and turns the negated translation back by it.
+	// Returns false and leaves outInverse untouched if the linear part is singular. The test is relative to the row
+	// lengths of the linear part, so large or small scales and translations invert like any other transform.
+	template<class T>
+	bool Inverse(const Transform3<T>& transform, Transform3<T>& outInverse)
+	{
+		auto linearInverse = Matrix<T, 3>();
+		if (!Inverse(transform.GetLinear(), linearInverse))
+		{
+			return false;
+		}
+
+		const Vector<T, 3> translation = transform.GetTranslation();
+		auto translationInverse = Vector<T, 3>::Zero();
+		for (size_t col = 0; col < 3; ++col)
+		{
+			translationInverse.At(col) = -(translation.At(0) * linearInverse.At(0, col) + translation.At(1) * linearInverse.At(1, col) + translation.At(2) * linearInverse.At(2, col));
+		}
+
+		outInverse = Transform3<T>(linearInverse, translationInverse);
+		return true;
+	}
+
+	// Returns a zero transform if the linear part is singular.
+	template<class T>
+	Transform3<T> Inverse(const Transform3<T>& transform)
+	{
+		auto result = Transform3<T>();
+		Inverse(transform, result);
+
+		return result;
+	}
+}
@@ -0,0 +1,218 @@
+#include "Trigonometry.h"
+
+#include <array>
+#include <cstdint>
+
+#include "Simd.h"
+
+namespace ABMath
+{
+	namespace
+	{
+		constexpr size_t SIN_TABLE_SIZE = 1024;
+		constexpr float SIN_TABLE_STEPS_PER_RADIAN = float(SIN_TABLE_SIZE) / Angle::TWO_PI;
+
+		// One full turn of sines plus a repeated first entry, so interpolation never wraps.
+		class SinTable
+		{
+		public:
+			SinTable()
+			{
+				for (size_t i = 0; i <= SIN_TABLE_SIZE; ++i)
+				{
+					_values[i] = static_cast<float>(std::sin(6.283185307179586 * double(i) / double(SIN_TABLE_SIZE)));
+				}
+			}
+
+			float Interpolate(const size_t index, const float fraction) const
+			{
+				const float from = _values[index];
+				return from + (_values[index + 1] - from) * fraction;
+			}
+
+		private:
+			std::array<float, SIN_TABLE_SIZE + 1> _values;
+		};
+
+		const SinTable& GetSinTable()
+		{
+			static const SinTable table;
+			return table;
+		}
+
+		SinCosPair InterpolateSinCos(const SinTable& table, const float radians)
+		{
+			if (!(std::fabs(radians) < Detail::APPROXIMATE_SIN_COS_LIMIT))
+			{
+				return SinCosPair{ std::sin(radians), std::cos(radians) };
+			}
+
+			const float steps = radians * SIN_TABLE_STEPS_PER_RADIAN;
+			const float wholeSteps = std::floor(steps);
+			const float fraction = steps - wholeSteps;
+
+			// Two's complement wrapping keeps the index in range for negative angles too.
+			const size_t sinIndex = static_cast<size_t>(static_cast<int64_t>(wholeSteps)) & (SIN_TABLE_SIZE - 1);
+			const size_t cosIndex = (sinIndex + SIN_TABLE_SIZE / 4) & (SIN_TABLE_SIZE - 1);
+
+			return SinCosPair{ table.Interpolate(sinIndex, fraction), table.Interpolate(cosIndex, fraction) };
+		}
+
+		// Four-lane Detail::PolynomialSinCos for |radians| < APPROXIMATE_SIN_COS_LIMIT, other lanes are garbage.
+		// Quadrant bookkeeping uses Round on values of the form n - 0.5, which are never ties, as a floor; selects
+		// are products with exact 0/1 weights.
+		void PolynomialSinCos4(const Simd::Float4 radians, Simd::Float4& outSines, Simd::Float4& outCosines)
+		{
+			using namespace Simd;
+
+			const Float4 one = Splat(1.f);
+			const Float4 two = Splat(2.f);
+			const Float4 half = Splat(0.5f);
+
+			const Float4 quadrant = Round(Multiply(radians, Splat(Detail::TWO_OVER_PI)));
+			Float4 reduced = Subtract(radians, Multiply(quadrant, Splat(Detail::PI_OVER_TWO_HIGH)));
+			reduced = Subtract(reduced, Multiply(quadrant, Splat(Detail::PI_OVER_TWO_MIDDLE)));
+			reduced = Subtract(reduced, Multiply(quadrant, Splat(Detail::PI_OVER_TWO_LOW)));
+			const Float4 reduced2 = Multiply(reduced, reduced);
+
+			Float4 sine = MultiplyAdd(reduced2, Splat(Detail::SIN_COEFFICIENT_7), Splat(Detail::SIN_COEFFICIENT_5));
+			sine = MultiplyAdd(reduced2, sine, Splat(Detail::SIN_COEFFICIENT_3));
+			sine = MultiplyAdd(Multiply(reduced, reduced2), sine, reduced);
+
+			Float4 cosine = MultiplyAdd(reduced2, Splat(Detail::COS_COEFFICIENT_8), Splat(Detail::COS_COEFFICIENT_6));
+			cosine = MultiplyAdd(reduced2, cosine, Splat(Detail::COS_COEFFICIENT_4));
+			cosine = MultiplyAdd(Multiply(reduced2, reduced2), cosine, Subtract(one, Multiply(half, reduced2)));
+
+			const Float4 halfTurns = Round(Multiply(Subtract(quadrant, half), half));
+			const Float4 isOdd = Subtract(quadrant, Multiply(two, halfTurns));
+			const Float4 isEven = Subtract(one, isOdd);
+			const Float4 halfTurnParity = Subtract(halfTurns, Multiply(two, Round(Multiply(Subtract(halfTurns, half), half))));
+			const Float4 sign = Subtract(one, Multiply(two, halfTurnParity));
+
+			outSines = Multiply(sign, MultiplyAdd(cosine, isOdd, Multiply(sine, isEven)));
+			outCosines = Multiply(sign, Subtract(Multiply(cosine, isEven), Multiply(sine, isOdd)));
+		}
+
+		// Replaces the garbage PolynomialSinCos4 leaves in lanes past the limit. Takes the angles by value, since
+		// the outputs may overwrite the input.
+		void FixLanesPastLimit(const Simd::Float4 radians, float* outSines, float* outCosines)
+		{
+			float lanes[4];
+			Simd::Store4(lanes, radians);
+			for (size_t i = 0; i < 4; ++i)
+			{
+				if (!(std::fabs(lanes[i]) < Detail::APPROXIMATE_SIN_COS_LIMIT))
+				{
+					outSines[i] = std::sin(lanes[i]);
+					outCosines[i] = std::cos(lanes[i]);
+				}
+			}
+		}
+
+		// Four-lane Detail::PolynomialAtan2.
+		Simd::Float4 PolynomialAtan24(const Simd::Float4 ys, const Simd::Float4 xs)
+		{
+			using namespace Simd;
+
+			const Float4 zero = Splat(0.f);
+
+			const Float4 absXs = Absolute(xs);
+			const Float4 absYs = Absolute(ys);
+			const Float4 largest = Max(absXs, absYs);
+			const Float4 smallest = Min(absXs, absYs);
+			const Float4 ratio = Select(Greater(largest, zero), Divide(smallest, largest), zero);
+			const Float4 ratio2 = Multiply(ratio, ratio);
+
+			Float4 polynomial = MultiplyAdd(ratio2, Splat(Detail::ATAN_COEFFICIENT_17), Splat(Detail::ATAN_COEFFICIENT_15));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_13));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_11));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_9));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_7));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_5));
+			polynomial = MultiplyAdd(ratio2, polynomial, Splat(Detail::ATAN_COEFFICIENT_3));
+
+			Float4 result = MultiplyAdd(Multiply(ratio, ratio2), polynomial, ratio);
+			result = Select(Greater(absYs, absXs), Subtract(Splat(Angle::PI_OVER_TWO), result), result);
+			result = Select(HasSignBit(xs), Subtract(Splat(Angle::PI), result), result);
+
+			return CopySign(result, ys);
+		}
+	}
+
+	namespace Detail
+	{
+		SinCosPair TableSinCos(const float radians)
+		{
+			return InterpolateSinCos(GetSinTable(), radians);
+		}
+
+		void ExactSinCos(const float* radians, const size_t count, float* outSines, float* outCosines)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				outSines[i] = std::sin(radians[i]);
+				outCosines[i] = std::cos(radians[i]);
+			}
+		}
+
+		void PolynomialSinCos(const float* radians, const size_t count, float* outSines, float* outCosines)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const Simd::Float4 angles = Simd::Load4(radians + i);
+				auto sines = Simd::Float4();
+				auto cosines = Simd::Float4();
+				PolynomialSinCos4(angles, sines, cosines);
+				Simd::Store4(outSines + i, sines);
+				Simd::Store4(outCosines + i, cosines);
+
+				if (!Simd::AreAllTrue(Simd::Greater(Simd::Splat(APPROXIMATE_SIN_COS_LIMIT), Simd::Absolute(angles))))
+				{
+					FixLanesPastLimit(angles, outSines + i, outCosines + i);
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				const SinCosPair sinCos = PolynomialSinCos(radians[i]);
+				outSines[i] = sinCos.sine;
+				outCosines[i] = sinCos.cosine;
+			}
+		}
+
+
+		void TableSinCos(const float* radians, const size_t count, float* outSines, float* outCosines)
+		{
+			const SinTable& table = GetSinTable();
+			for (size_t i = 0; i < count; ++i)
+			{
+				const SinCosPair sinCos = InterpolateSinCos(table, radians[i]);
+				outSines[i] = sinCos.sine;
+				outCosines[i] = sinCos.cosine;
+			}
+		}
+
+		void ExactAtan2(const float* ys, const float* xs, const size_t count, float* outRadians)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				outRadians[i] = std::atan2(ys[i], xs[i]);
+			}
+		}
+
+		void PolynomialAtan2(const float* ys, const float* xs, const size_t count, float* outRadians)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				Simd::Store4(outRadians + i, PolynomialAtan24(Simd::Load4(ys + i), Simd::Load4(xs + i)));
+			}
+
+			for (; i < count; ++i)
+			{
+				outRadians[i] = PolynomialAtan2(ys[i], xs[i]);
+			}
+		}
+	}
+}
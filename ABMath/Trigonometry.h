@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Angle.h"
+
+// The library-wide precision tier is chosen at compile time: define ABMATH_TRIG_POLYNOMIAL or
+// ABMATH_TRIG_TABLE for the whole build to switch every SinCos call that does not name a tier.
+#if defined(ABMATH_TRIG_POLYNOMIAL) && defined(ABMATH_TRIG_TABLE)
+#error "Define at most one of ABMATH_TRIG_POLYNOMIAL and ABMATH_TRIG_TABLE"
+#endif
+
+namespace ABMath
+{
+	// Exact: std::sin/std::cos and std::atan2.
+	// Polynomial: minimax polynomials after a three-part reduction by pi/2, max error 1e-7. The reduction is only
+	// exact for |radians| < 8192, so larger inputs, infinities and NaN fall back to std::sin/std::cos.
+	// Atan2 uses a degree 17 odd polynomial on [0, 1] after folding octants, max error 4e-7.
+	// Table: linear interpolation in a 1024-entry table, max error 5e-6 within one turn and 1e-5 for |radians| < 64,
+	// growing with the argument as the table position loses fractional bits. It falls back like the polynomial tier
+	// from 8192 on. Atan2 has no table and uses the polynomial.
+	enum class TrigPrecision
+	{
+		Exact,
+		Polynomial,
+		Table
+	};
+
+#if defined(ABMATH_TRIG_POLYNOMIAL)
+	constexpr TrigPrecision DEFAULT_TRIG_PRECISION = TrigPrecision::Polynomial;
+#elif defined(ABMATH_TRIG_TABLE)
+	constexpr TrigPrecision DEFAULT_TRIG_PRECISION = TrigPrecision::Table;
+#else
+	constexpr TrigPrecision DEFAULT_TRIG_PRECISION = TrigPrecision::Exact;
+#endif
+
+	struct SinCosPair
+	{
+		float sine;
+		float cosine;
+	};
+
+	namespace Detail
+	{
+		constexpr float TWO_OVER_PI = 0.636619772367581343f;
+		// pi / 2 split so that quadrant * PI_OVER_TWO_HIGH and quadrant * PI_OVER_TWO_MIDDLE are exact for |quadrant| < 2^13.
+		constexpr float PI_OVER_TWO_HIGH = 1.5703125f;
+		constexpr float PI_OVER_TWO_MIDDLE = 4.837512969970703125e-4f;
+		constexpr float PI_OVER_TWO_LOW = 7.54978995489188216e-8f;
+		// The approximate SinCos tiers hand |radians| from here on to std::sin/std::cos. This also keeps the quadrant
+		// and table index conversions to integers in range.
+		constexpr float APPROXIMATE_SIN_COS_LIMIT = 8192.f;
+
+		// Minimax coefficients for [-pi/4, pi/4].
+		constexpr float SIN_COEFFICIENT_3 = -1.6666654611e-1f;
+		constexpr float SIN_COEFFICIENT_5 = 8.3321608736e-3f;
+		constexpr float SIN_COEFFICIENT_7 = -1.9515295891e-4f;
+		constexpr float COS_COEFFICIENT_4 = 4.166664568298827e-2f;
+		constexpr float COS_COEFFICIENT_6 = -1.388731625493765e-3f;
+		constexpr float COS_COEFFICIENT_8 = 2.443315711809948e-5f;
+
+		inline SinCosPair PolynomialSinCos(const float radians)
+		{
+			if (!(std::fabs(radians) < APPROXIMATE_SIN_COS_LIMIT))
+			{
+				return SinCosPair{ std::sin(radians), std::cos(radians) };
+			}
+
+			const float scaled = radians * TWO_OVER_PI;
+			const int32_t quadrantIndex = static_cast<int32_t>(scaled + (scaled < 0.f ? -0.5f : 0.5f));
+			const float quadrant = static_cast<float>(quadrantIndex);
+			const float reduced = ((radians - quadrant * PI_OVER_TWO_HIGH) - quadrant * PI_OVER_TWO_MIDDLE) - quadrant * PI_OVER_TWO_LOW;
+			const float reduced2 = reduced * reduced;
+
+			const float sine = reduced + reduced * reduced2 * (SIN_COEFFICIENT_3 + reduced2 * (SIN_COEFFICIENT_5 + reduced2 * SIN_COEFFICIENT_7));
+			const float cosine = 1.f - 0.5f * reduced2 + reduced2 * reduced2 * (COS_COEFFICIENT_4 + reduced2 * (COS_COEFFICIENT_6 + reduced2 * COS_COEFFICIENT_8));
+
+			// Quadrant q maps (sin, cos) to (s, c), (c, -s), (-s, -c), (-c, s). The 0/1 weights select exactly
+			// without branching on the quadrant.
+			const float isOdd = static_cast<float>(quadrantIndex & 1);
+			const float isEven = 1.f - isOdd;
+			const float sign = 1.f - static_cast<float>(quadrantIndex & 2);
+
+			return SinCosPair{ sign * (sine * isEven + cosine * isOdd), sign * (cosine * isEven - sine * isOdd) };
+		}
+
+		// Abramowitz and Stegun 4.4.49, atan(t) for t in [0, 1].
+		constexpr float ATAN_COEFFICIENT_3 = -0.3333314528f;
+		constexpr float ATAN_COEFFICIENT_5 = 0.1999355085f;
+		constexpr float ATAN_COEFFICIENT_7 = -0.1420889944f;
+		constexpr float ATAN_COEFFICIENT_9 = 0.1065626393f;
+		constexpr float ATAN_COEFFICIENT_11 = -0.0752896400f;
+		constexpr float ATAN_COEFFICIENT_13 = 0.0429096138f;
+		constexpr float ATAN_COEFFICIENT_15 = -0.0161657367f;
+		constexpr float ATAN_COEFFICIENT_17 = 0.0028662257f;
+
+		// Evaluates atan on min(|x|, |y|) / max(|x|, |y|) and unfolds the octant from the signs and the larger
+		// component. Signed zeros give the same results as std::atan2; inputs must be finite.
+		inline float PolynomialAtan2(const float y, const float x)
+		{
+			const float absX = std::fabs(x);
+			const float absY = std::fabs(y);
+			const float largest = absX > absY ? absX : absY;
+			const float smallest = absX > absY ? absY : absX;
+			const float ratio = largest > 0.f ? smallest / largest : 0.f;
+			const float ratio2 = ratio * ratio;
+
+			float polynomial = ATAN_COEFFICIENT_15 + ratio2 * ATAN_COEFFICIENT_17;
+			polynomial = ATAN_COEFFICIENT_13 + ratio2 * polynomial;
+			polynomial = ATAN_COEFFICIENT_11 + ratio2 * polynomial;
+			polynomial = ATAN_COEFFICIENT_9 + ratio2 * polynomial;
+			polynomial = ATAN_COEFFICIENT_7 + ratio2 * polynomial;
+			polynomial = ATAN_COEFFICIENT_5 + ratio2 * polynomial;
+			polynomial = ATAN_COEFFICIENT_3 + ratio2 * polynomial;
+
+			float result = ratio + ratio * ratio2 * polynomial;
+			result = absY > absX ? Angle::PI_OVER_TWO - result : result;
+			result = std::signbit(x) ? Angle::PI - result : result;
+
+			return std::copysign(result, y);
+		}
+
+		SinCosPair TableSinCos(const float radians);
+
+		void ExactSinCos(const float* radians, const size_t count, float* outSines, float* outCosines);
+		void PolynomialSinCos(const float* radians, const size_t count, float* outSines, float* outCosines);
+		void TableSinCos(const float* radians, const size_t count, float* outSines, float* outCosines);
+
+		void ExactAtan2(const float* ys, const float* xs, const size_t count, float* outRadians);
+		void PolynomialAtan2(const float* ys, const float* xs, const size_t count, float* outRadians);
+	}
+
+	template<TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	SinCosPair SinCos(const float radians)
+	{
+		if constexpr (PRECISION == TrigPrecision::Polynomial)
+		{
+			return Detail::PolynomialSinCos(radians);
+		}
+		else if constexpr (PRECISION == TrigPrecision::Table)
+		{
+			return Detail::TableSinCos(radians);
+		}
+		else
+		{
+			return SinCosPair{ std::sin(radians), std::cos(radians) };
+		}
+	}
+
+	template<TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	SinCosPair SinCos(const Angle& angle)
+	{
+		return SinCos<PRECISION>(angle.GetRadians());
+	}
+
+	// Fills outSines[i] and outCosines[i] for radians[i]. The polynomial tier processes four angles per SIMD step
+	// and agrees with the single-angle version within its error bound.
+	template<TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	void SinCos(const float* radians, const size_t count, float* outSines, float* outCosines)
+	{
+		if constexpr (PRECISION == TrigPrecision::Polynomial)
+		{
+			Detail::PolynomialSinCos(radians, count, outSines, outCosines);
+		}
+		else if constexpr (PRECISION == TrigPrecision::Table)
+		{
+			Detail::TableSinCos(radians, count, outSines, outCosines);
+		}
+		else
+		{
+			Detail::ExactSinCos(radians, count, outSines, outCosines);
+		}
+	}
+
+	template<TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	float Atan2(const float y, const float x)
+	{
+		if constexpr (PRECISION == TrigPrecision::Exact)
+		{
+			return std::atan2(y, x);
+		}
+		else
+		{
+			return Detail::PolynomialAtan2(y, x);
+		}
+	}
+
+	// Fills outRadians[i] with the angle of (xs[i], ys[i]). The approximate tiers process four pairs per SIMD step
+	// and agree with the single-pair version within its error bound.
+	template<TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	void Atan2(const float* ys, const float* xs, const size_t count, float* outRadians)
+	{
+		if constexpr (PRECISION == TrigPrecision::Exact)
+		{
+			Detail::ExactAtan2(ys, xs, count, outRadians);
+		}
+		else
+		{
+			Detail::PolynomialAtan2(ys, xs, count, outRadians);
+		}
+	}
+}
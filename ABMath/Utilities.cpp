@@ -2,6 +2,22 @@
 
 namespace ABMath
 {
+	namespace
+	{
+		FMatrix4 CreateRotationMatrix4(const Quaternion& quaternion)
+		{
+			const FMatrix3 rotation = QuaternionToMatrix(quaternion);
+
+			auto result = FMatrix4::Identity();
+			ForEach(rotation, [&result, &rotation](const size_t row, const size_t col)
+			{
+				result.At(row, col) = rotation.At(row, col);
+			});
+
+			return result;
+		}
+	}
+
 	EulerAngles QuaternionToEulerAngles(const Quaternion& quaternion)
 	{
 		auto result = EulerAngles();
@@ -33,6 +49,29 @@ namespace ABMath
 		return result;
 	}
 
+	Quaternion EulerAnglesToQuaternion(const EulerAngles& eulerAngles)
+	{
+		const float halfHeading = eulerAngles.GetHeading().GetRadians() / 2.f;
+		const float halfPitch = eulerAngles.GetPitch().GetRadians() / 2.f;
+		const float halfBank = eulerAngles.GetBank().GetRadians() / 2.f;
+
+		const SinCosPair heading = SinCos(halfHeading);
+		const SinCosPair pitch = SinCos(halfPitch);
+		const SinCosPair bank = SinCos(halfBank);
+		const float ch = heading.cosine;
+		const float sh = heading.sine;
+		const float cp = pitch.cosine;
+		const float sp = pitch.sine;
+		const float cb = bank.cosine;
+		const float sb = bank.sine;
+
+		return Quaternion(
+			ch*cp*cb + sh*sp*sb,
+			ch*sp*cb + sh*cp*sb,
+			sh*cp*cb - ch*sp*sb,
+			ch*cp*sb - sh*sp*cb);
+	}
+
 	FMatrix3 QuaternionToMatrix(const Quaternion& quaternion)
 	{
 		auto result = FMatrix3();
@@ -56,4 +95,24 @@ namespace ABMath
 
 		return result;
 	}
+
+	void RotateMany(const Quaternion& quaternion, const FVector3* vectors, const size_t count, FVector3* outVectors)
+	{
+		TransformDirections(vectors, count, CreateRotationMatrix4(quaternion), outVectors);
+	}
+
+	void RotateMany(const Quaternion& quaternion, FVector3* inOutVectors, const size_t count)
+	{
+		TransformDirections(inOutVectors, count, CreateRotationMatrix4(quaternion));
+	}
+
+	void RotateMany(const Quaternion& quaternion, const FVectorArray3& vectors, FVectorArray3& outVectors)
+	{
+		TransformDirections(vectors, CreateRotationMatrix4(quaternion), outVectors);
+	}
+
+	void RotateMany(const Quaternion& quaternion, FVectorArray3& inOutVectors)
+	{
+		TransformDirections(inOutVectors, CreateRotationMatrix4(quaternion));
+	}
 }
\ No newline at end of file
@@ -1,32 +1,149 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <vector>
 
 #include "AxisAngle.h"
 #include "EulerAngles.h"
 #include "Matrix.h"
+#include "Parallel.h"
 #include "Point.h"
 #include "PolarVector.h"
+#include "Rotation2.h"
+#include "Transform3.h"
 #include "Vector.h"
+#include "VectorArray.h"
 #include "Quaternion.h"
 
 namespace ABMath
 {
-	template<typename T>
+	// The cross and dot products are accumulated in T, only the atan2 runs in float.
+	template<typename T, TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
 	Angle CalculateAngleBetweenClockwise(const Vector<T, 2>& vector1, const Vector<T, 2>& vector2)
 	{
-		const float crossProduct = vector1.At(0) * vector2.At(1) - vector1.At(1) * vector2.At(0);
-		const float dotProduct = DotProduct(vector1, vector2);
+		const T crossProduct = vector1.At(0) * vector2.At(1) - vector1.At(1) * vector2.At(0);
+		const T dotProduct = vector1.At(0) * vector2.At(0) + vector1.At(1) * vector2.At(1);
 
-		const float radians = std::atan2(crossProduct, dotProduct);
+		const float radians = Atan2<PRECISION>(static_cast<float>(crossProduct), static_cast<float>(dotProduct));
 
 		return Angle::CreateWithRadians(radians);
 	}
 
+	// The unsigned angle in [0, pi], taken as atan2(|cross|, dot), which stays accurate for nearly parallel vectors.
+	template<typename T, TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	Angle CalculateAngleBetween(const Vector<T, 3>& vector1, const Vector<T, 3>& vector2)
+	{
+		const Vector<T, 3> crossProduct = CrossProduct(vector1, vector2);
+		const T crossLengthSquared = crossProduct.At(0) * crossProduct.At(0) + crossProduct.At(1) * crossProduct.At(1) + crossProduct.At(2) * crossProduct.At(2);
+		const T dotProduct = vector1.At(0) * vector2.At(0) + vector1.At(1) * vector2.At(1) + vector1.At(2) * vector2.At(2);
+
+		// The square root is taken in float, so integer vectors do not lose the fractional part of the length.
+		const float crossLength = std::sqrt(static_cast<float>(crossLengthSquared));
+		const float radians = Atan2<PRECISION>(crossLength, static_cast<float>(dotProduct));
+
+		return Angle::CreateWithRadians(radians);
+	}
+
+	namespace Detail
+	{
+		// Angles are computed this many at a time, so the atan2 inputs stay in buffers on the stack.
+		constexpr size_t ANGLE_BLOCK_SIZE = 256;
+	}
+
+	// Batched CalculateAngleBetweenClockwise, outRadians[i] is the angle from vectors1[i] to vectors2[i].
+	// Both arrays must have the same size.
+	template<typename T, TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	void CalculateAnglesBetweenClockwise(const VectorArray<T, 2>& vectors1, const VectorArray<T, 2>& vectors2, std::vector<float>& outRadians)
+	{
+		assert(vectors1.GetSize() == vectors2.GetSize());
+
+		const size_t count = vectors1.GetSize();
+		outRadians.resize(count);
+
+		const T* xs1 = vectors1.GetLane(0);
+		const T* ys1 = vectors1.GetLane(1);
+		const T* xs2 = vectors2.GetLane(0);
+		const T* ys2 = vectors2.GetLane(1);
+		float* radians = outRadians.data();
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float crossProducts[Detail::ANGLE_BLOCK_SIZE];
+			float dotProducts[Detail::ANGLE_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += Detail::ANGLE_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, Detail::ANGLE_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					crossProducts[j] = static_cast<float>(xs1[i] * ys2[i] - ys1[i] * xs2[i]);
+					dotProducts[j] = static_cast<float>(xs1[i] * xs2[i] + ys1[i] * ys2[i]);
+				}
+
+				Atan2<PRECISION>(crossProducts, dotProducts, blockSize, radians + block);
+			}
+		});
+	}
+
+	// Batched CalculateAngleBetween, outRadians[i] is the unsigned angle between vectors1[i] and vectors2[i].
+	// Both arrays must have the same size.
+	template<typename T, TrigPrecision PRECISION = DEFAULT_TRIG_PRECISION>
+	void CalculateAnglesBetween(const VectorArray<T, 3>& vectors1, const VectorArray<T, 3>& vectors2, std::vector<float>& outRadians)
+	{
+		assert(vectors1.GetSize() == vectors2.GetSize());
+
+		const size_t count = vectors1.GetSize();
+		outRadians.resize(count);
+
+		const T* xs1 = vectors1.GetLane(0);
+		const T* ys1 = vectors1.GetLane(1);
+		const T* zs1 = vectors1.GetLane(2);
+		const T* xs2 = vectors2.GetLane(0);
+		const T* ys2 = vectors2.GetLane(1);
+		const T* zs2 = vectors2.GetLane(2);
+		float* radians = outRadians.data();
+
+		ParallelFor(count, [=](const size_t begin, const size_t end)
+		{
+			float crossLengths[Detail::ANGLE_BLOCK_SIZE];
+			float dotProducts[Detail::ANGLE_BLOCK_SIZE];
+			for (size_t block = begin; block < end; block += Detail::ANGLE_BLOCK_SIZE)
+			{
+				const size_t blockSize = std::min(end - block, Detail::ANGLE_BLOCK_SIZE);
+				for (size_t j = 0; j < blockSize; ++j)
+				{
+					const size_t i = block + j;
+					const T crossX = ys1[i] * zs2[i] - zs1[i] * ys2[i];
+					const T crossY = zs1[i] * xs2[i] - xs1[i] * zs2[i];
+					const T crossZ = xs1[i] * ys2[i] - ys1[i] * xs2[i];
+					crossLengths[j] = std::sqrt(static_cast<float>(crossX * crossX + crossY * crossY + crossZ * crossZ));
+					dotProducts[j] = static_cast<float>(xs1[i] * xs2[i] + ys1[i] * ys2[i] + zs1[i] * zs2[i]);
+				}
+
+				Atan2<PRECISION>(crossLengths, dotProducts, blockSize, radians + block);
+			}
+		});
+	}
+
 	template<class T, size_t SIZE>
 	Vector<T, SIZE> Multiply(const Vector<T, SIZE>& vec, const Matrix<T, SIZE>& mat)
 	{
 		auto result = Vector<T, SIZE>::Zero();
+
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			auto sum = Simd::Multiply(Simd::Splat(vec.At(0)), Simd::Load<SIZE>(mat.GetData()));
+			ForEachIndex<SIZE - 1>([&sum, &vec, &mat](const size_t i)
+			{
+				const size_t row = i + 1;
+				sum = Simd::MultiplyAdd(Simd::Splat(vec.At(row)), Simd::Load<SIZE>(mat.GetData() + row * SIZE), sum);
+			});
+			Simd::Store<SIZE>(result.GetData(), sum);
+
+			return result;
+		}
 		for (size_t resultCol = 0; resultCol < SIZE; ++resultCol)
 		{
 			for (size_t sourceCol = 0; sourceCol < SIZE; ++sourceCol)
@@ -38,6 +155,146 @@ namespace ABMath
 		return result;
 	}
 
+	// Solves matrix * outSolution = vector with the vector taken as a column.
+	// Returns false and leaves outSolution untouched if the matrix is singular.
+	template<class T, size_t SIZE>
+	bool Solve(const Matrix<T, SIZE>& matrix, const Vector<T, SIZE>& vector, Vector<T, SIZE>& outSolution)
+	{
+		auto lu = Matrix<T, SIZE>();
+		auto permutation = Permutation<SIZE>();
+		auto sign = T();
+		if (!DecomposeLU(matrix, lu, permutation, sign))
+		{
+			return false;
+		}
+
+		auto b = typename Matrix<T, SIZE>::RowType();
+		for (size_t i = 0; i < SIZE; ++i)
+		{
+			b[i] = vector.At(i);
+		}
+
+		outSolution = Vector<T, SIZE>(SolveLU(lu, permutation, b));
+		return true;
+	}
+
+	namespace Detail
+	{
+		// Multiplies [x, y, z, w] by the matrix and keeps [x, y, z]; the projective column is ignored.
+		template<class T>
+		void TransformVectors(const Vector<T, 3>* vectors, const size_t count, const Matrix<T, 4>& matrix, const T& w, Vector<T, 3>* outVectors)
+		{
+			if constexpr (IS_SIMD_MATRIX<T, 4>)
+			{
+				const auto row0 = Simd::Load4(matrix.GetData());
+				const auto row1 = Simd::Load4(matrix.GetData() + 4);
+				const auto row2 = Simd::Load4(matrix.GetData() + 8);
+				const auto translation = Simd::Multiply(Simd::Load4(matrix.GetData() + 12), Simd::Splat(w));
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const float* in = vectors[i].GetData();
+					auto sum = Simd::MultiplyAdd(Simd::Splat(in[0]), row0, translation);
+					sum = Simd::MultiplyAdd(Simd::Splat(in[1]), row1, sum);
+					sum = Simd::MultiplyAdd(Simd::Splat(in[2]), row2, sum);
+					Simd::Store3(outVectors[i].GetData(), sum);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					const T x = vectors[i].At(0);
+					const T y = vectors[i].At(1);
+					const T z = vectors[i].At(2);
+					for (size_t col = 0; col < 3; ++col)
+					{
+						outVectors[i].At(col) = x * matrix.At(0, col) + y * matrix.At(1, col) + z * matrix.At(2, col) + w * matrix.At(3, col);
+					}
+				}
+			}
+		}
+
+		template<class T>
+		void TransformVectors(const VectorArray<T, 3>& vectors, const Matrix<T, 4>& matrix, const T& w, VectorArray<T, 3>& outVectors)
+		{
+			const size_t count = vectors.GetSize();
+			outVectors.Resize(count);
+
+			const T* xs = vectors.GetLane(0);
+			const T* ys = vectors.GetLane(1);
+			const T* zs = vectors.GetLane(2);
+			T* outXs = outVectors.GetLane(0);
+			T* outYs = outVectors.GetLane(1);
+			T* outZs = outVectors.GetLane(2);
+
+			const T m00 = matrix.At(0, 0), m01 = matrix.At(0, 1), m02 = matrix.At(0, 2);
+			const T m10 = matrix.At(1, 0), m11 = matrix.At(1, 1), m12 = matrix.At(1, 2);
+			const T m20 = matrix.At(2, 0), m21 = matrix.At(2, 1), m22 = matrix.At(2, 2);
+			const T t0 = w * matrix.At(3, 0), t1 = w * matrix.At(3, 1), t2 = w * matrix.At(3, 2);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const T x = xs[i];
+				const T y = ys[i];
+				const T z = zs[i];
+				outXs[i] = x * m00 + y * m10 + z * m20 + t0;
+				outYs[i] = x * m01 + y * m11 + z * m21 + t1;
+				outZs[i] = x * m02 + y * m12 + z * m22 + t2;
+			}
+		}
+	}
+
+	// Transforms points (w = 1) by an affine matrix. outPoints may equal points.
+	template<class T>
+	void TransformPoints(const Vector<T, 3>* points, const size_t count, const Matrix<T, 4>& matrix, Vector<T, 3>* outPoints)
+	{
+		Detail::TransformVectors(points, count, matrix, T(1), outPoints);
+	}
+
+	template<class T>
+	void TransformPoints(Vector<T, 3>* inOutPoints, const size_t count, const Matrix<T, 4>& matrix)
+	{
+		Detail::TransformVectors(inOutPoints, count, matrix, T(1), inOutPoints);
+	}
+
+	template<class T>
+	void TransformPoints(const VectorArray<T, 3>& points, const Matrix<T, 4>& matrix, VectorArray<T, 3>& outPoints)
+	{
+		Detail::TransformVectors(points, matrix, T(1), outPoints);
+	}
+
+	template<class T>
+	void TransformPoints(VectorArray<T, 3>& inOutPoints, const Matrix<T, 4>& matrix)
+	{
+		Detail::TransformVectors(inOutPoints, matrix, T(1), inOutPoints);
+	}
+
+	// Transforms directions (w = 0), so the translation row is ignored. outDirections may equal directions.
+	template<class T>
+	void TransformDirections(const Vector<T, 3>* directions, const size_t count, const Matrix<T, 4>& matrix, Vector<T, 3>* outDirections)
+	{
+		Detail::TransformVectors(directions, count, matrix, T(0), outDirections);
+	}
+
+	template<class T>
+	void TransformDirections(Vector<T, 3>* inOutDirections, const size_t count, const Matrix<T, 4>& matrix)
+	{
+		Detail::TransformVectors(inOutDirections, count, matrix, T(0), inOutDirections);
+	}
+
+	template<class T>
+	void TransformDirections(const VectorArray<T, 3>& directions, const Matrix<T, 4>& matrix, VectorArray<T, 3>& outDirections)
+	{
+		Detail::TransformVectors(directions, matrix, T(0), outDirections);
+	}
+
+	template<class T>
+	void TransformDirections(VectorArray<T, 3>& inOutDirections, const Matrix<T, 4>& matrix)
+	{
+		Detail::TransformVectors(inOutDirections, matrix, T(0), inOutDirections);
+	}
+
 	template<class T>
 	Vector<T, 3> ProjectOntoX(const Vector<T, 3>& vec, const T& x)
 	{
@@ -51,9 +308,9 @@ namespace ABMath
 	Vector<T, 2> PolarVectorToVector(const PolarVector2<T>& polarVector)
 	{
 		const T radius = polarVector.GetLength();
-		const float angle = polarVector.GetAngle().GetRadians();
-		const T x = static_cast<T>(radius * std::cos(angle));
-		const T y = static_cast<T>(radius * std::sin(angle));
+		const SinCosPair angle = SinCos(polarVector.GetAngle());
+		const T x = static_cast<T>(radius * angle.cosine);
+		const T y = static_cast<T>(radius * angle.sine);
 
 		return Vector<T, 2>({ x, y });
 	}
@@ -62,9 +319,9 @@ namespace ABMath
 	Vector<T, 3> PolarVectorToVector(const PolarCylindricalVector3<T>& polarVector)
 	{
 		const T radius = polarVector.GetLength();
-		const float angle = polarVector.GetAngle().GetRadians();
-		const T x = static_cast<T>(radius * std::cos(angle));
-		const T y = static_cast<T>(radius * std::sin(angle));
+		const SinCosPair angle = SinCos(polarVector.GetAngle());
+		const T x = static_cast<T>(radius * angle.cosine);
+		const T y = static_cast<T>(radius * angle.sine);
 
 		return Vector<T, 3>({ x, y, polarVector.GetHeight() });
 	}
@@ -73,11 +330,11 @@ namespace ABMath
 	Vector<T, 3> PolarVectorToVector(const ClassicPolarVector3<T> polarVector)
 	{
 		const T length = polarVector.GetLength();
-		const float horAngle = polarVector.GetHorizontalAngle().GetRadians();
-		const float vertAngle = polarVector.GetVerticalAngle().GetRadians();
-		const T x = static_cast<T>(length * std::sin(vertAngle) * std::cos(horAngle));
-		const T y = static_cast<T>(length * std::sin(vertAngle) * std::sin(horAngle));
-		const T z = static_cast<T>(length * std::cos(vertAngle));
+		const SinCosPair horAngle = SinCos(polarVector.GetHorizontalAngle());
+		const SinCosPair vertAngle = SinCos(polarVector.GetVerticalAngle());
+		const T x = static_cast<T>(length * vertAngle.sine * horAngle.cosine);
+		const T y = static_cast<T>(length * vertAngle.sine * horAngle.sine);
+		const T z = static_cast<T>(length * vertAngle.cosine);
 
 		return Vector<T, 3>({ x, y, z });
 	}
@@ -86,11 +343,11 @@ namespace ABMath
 	Vector<T, 3> PolarVectorToVector(const PolarVector3<T>& polarVector)
 	{
 		const T length = polarVector.GetLength();
-		const float heading = polarVector.GetHeading().GetRadians();
-		const float pitch = polarVector.GetPitch().GetRadians();
-		const T x = static_cast<T>(length * std::cos(pitch) * std::sin(heading));
-		const T y = static_cast<T>(-length * std::sin(pitch));
-		const T z = static_cast<T>(length * std::cos(pitch) * std::cos(heading));
+		const SinCosPair heading = SinCos(polarVector.GetHeading());
+		const SinCosPair pitch = SinCos(polarVector.GetPitch());
+		const T x = static_cast<T>(length * pitch.cosine * heading.sine);
+		const T y = static_cast<T>(-length * pitch.sine);
+		const T z = static_cast<T>(length * pitch.cosine * heading.cosine);
 
 		return Vector<T, 3>({ x, y, z });
 	}
@@ -115,6 +372,30 @@ namespace ABMath
 		return PolarCylindricalVector3<T>(polarVector2, vector.At(2));
 	}
 
+	// The vertical angle is measured from the z axis, so it is within [0, pi] and is not folded into the [-pi/2, pi/2]
+	// of ToCanonicalForm. The horizontal angle is zero along the z axis, where ToCanonicalForm also zeroes it.
+	template<class T>
+	ClassicPolarVector3<T> VectorToClassicPolarVector(const Vector<T, 3>& vector)
+	{
+		const T x = vector.At(0);
+		const T y = vector.At(1);
+		const T z = vector.At(2);
+
+		const auto length = T(std::hypot(x, y, z));
+		float horAngle = 0.f;
+		float vertAngle = 0.f;
+		if (length > T(0))
+		{
+			vertAngle = static_cast<float>(std::atan2(std::hypot(x, y), z));
+			if (vertAngle > 0.0001f)
+			{
+				horAngle = static_cast<float>(std::atan2(y, x));
+			}
+		}
+
+		return ClassicPolarVector3<T>(length, Angle::CreateWithRadians(horAngle), Angle::CreateWithRadians(vertAngle));
+	}
+
 	template<class T>
 	PolarVector3<T> VectorToPolarVector(const Vector<T, 3>& vector)
 	{
@@ -167,17 +448,92 @@ namespace ABMath
 
 	EulerAngles QuaternionToEulerAngles(const Quaternion& quaternion);
 
+	Quaternion EulerAnglesToQuaternion(const EulerAngles& eulerAngles);
+
+	// Shepperd's method: recovers the largest quaternion component from the trace or a diagonal
+	// element and the other three from sums and differences of the off-diagonal elements.
+	template<class T>
+	Quaternion MatrixToQuaternion(const Matrix<T, 3>& matrix)
+	{
+		const float m00 = static_cast<float>(matrix.At(0, 0));
+		const float m11 = static_cast<float>(matrix.At(1, 1));
+		const float m22 = static_cast<float>(matrix.At(2, 2));
+
+		const float fourW2 = 1.f + m00 + m11 + m22;
+		const float fourX2 = 1.f + m00 - m11 - m22;
+		const float fourY2 = 1.f - m00 + m11 - m22;
+		const float fourZ2 = 1.f - m00 - m11 + m22;
+
+		const float fourWX = static_cast<float>(matrix.At(1, 2) - matrix.At(2, 1));
+		const float fourWY = static_cast<float>(matrix.At(2, 0) - matrix.At(0, 2));
+		const float fourWZ = static_cast<float>(matrix.At(0, 1) - matrix.At(1, 0));
+		const float fourXY = static_cast<float>(matrix.At(0, 1) + matrix.At(1, 0));
+		const float fourXZ = static_cast<float>(matrix.At(2, 0) + matrix.At(0, 2));
+		const float fourYZ = static_cast<float>(matrix.At(1, 2) + matrix.At(2, 1));
+
+		if (fourW2 >= fourX2 && fourW2 >= fourY2 && fourW2 >= fourZ2)
+		{
+			const float scale = 0.5f / std::sqrt(fourW2);
+			return Quaternion(fourW2 * scale, fourWX * scale, fourWY * scale, fourWZ * scale);
+		}
+		else if (fourX2 >= fourY2 && fourX2 >= fourZ2)
+		{
+			const float scale = 0.5f / std::sqrt(fourX2);
+			return Quaternion(fourWX * scale, fourX2 * scale, fourXY * scale, fourXZ * scale);
+		}
+		else if (fourY2 >= fourZ2)
+		{
+			const float scale = 0.5f / std::sqrt(fourY2);
+			return Quaternion(fourWY * scale, fourXY * scale, fourY2 * scale, fourYZ * scale);
+		}
+		else
+		{
+			const float scale = 0.5f / std::sqrt(fourZ2);
+			return Quaternion(fourWZ * scale, fourXZ * scale, fourYZ * scale, fourZ2 * scale);
+		}
+	}
+
 	FMatrix3 QuaternionToMatrix(const Quaternion& quaternion);
 
+	// Rotates by a unit quaternion as v + w * t + cross(q, t) with t = 2 * cross(q, v),
+	// which matches Multiply(vector, QuaternionToMatrix(quaternion)).
+	inline FVector3 Rotate(const Quaternion& quaternion, const FVector3& vector)
+	{
+		const float w = quaternion.GetW();
+		const float qx = quaternion.GetX();
+		const float qy = quaternion.GetY();
+		const float qz = quaternion.GetZ();
+
+		const float vx = vector.At(0);
+		const float vy = vector.At(1);
+		const float vz = vector.At(2);
+
+		const float tx = 2.f * (qy * vz - qz * vy);
+		const float ty = 2.f * (qz * vx - qx * vz);
+		const float tz = 2.f * (qx * vy - qy * vx);
+
+		return FVector3({
+			vx + w * tx + (qy * tz - qz * ty),
+			vy + w * ty + (qz * tx - qx * tz),
+			vz + w * tz + (qx * ty - qy * tx) });
+	}
+
+	// Batched rotation by one unit quaternion, outVectors may equal vectors.
+	void RotateMany(const Quaternion& quaternion, const FVector3* vectors, const size_t count, FVector3* outVectors);
+	void RotateMany(const Quaternion& quaternion, FVector3* inOutVectors, const size_t count);
+	void RotateMany(const Quaternion& quaternion, const FVectorArray3& vectors, FVectorArray3& outVectors);
+	void RotateMany(const Quaternion& quaternion, FVectorArray3& inOutVectors);
+
 	template<class T>
 	Quaternion AxisAngleToQuaternion(const AxisAngle<T>& axisAngle)
 	{
 		const Angle halfAngle = axisAngle.GetAngle() / 2.f;
 
-		const float w = std::cos(halfAngle.GetRadians());
+		const SinCosPair halfAngleSinCos = SinCos(halfAngle);
+		const float w = halfAngleSinCos.cosine;
 
 		const auto normalizedAxis = CreateNormalized(axisAngle.GetAxis());
-		const float sinHalfAngle = std::sin(halfAngle.GetRadians());
+		const float sinHalfAngle = halfAngleSinCos.sine;
 		const float x = normalizedAxis.At(0) * sinHalfAngle;
 		const float y = normalizedAxis.At(1) * sinHalfAngle;
 		const float z = normalizedAxis.At(2) * sinHalfAngle;
@@ -185,12 +541,10 @@ namespace ABMath
 		return Quaternion(w, x, y, z);
 	}
 
+	// Build a Rotation2 once instead when many vectors turn by the same angle.
 	template<class T>
 	Vector<T, 2> RotateVector(const Vector<T, 2>& vector, const Angle& angle)
 	{
-		const auto vec3 = Vector2ToVector3(vector);
-		const auto rotMat = CreateRotationZ<T, 3>(angle);
-		const auto resultVec = Multiply(vec3, rotMat);
-		return Vector3ToVector2(resultVec);
+		return Rotate(Rotation2<T>(angle), vector);
 	}
 }
@@ -1,14 +1,17 @@
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <initializer_list>
 #include <iomanip>
 #include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
-#include <vector>
+#include <utility>
 
 #include "Float.h"
+#include "Simd.h"
 
 namespace ABMath
 {
@@ -16,7 +19,7 @@ namespace ABMath
 	class Vector
 	{
 	public:
-		using DataType = std::vector<T>;
+		using DataType = std::array<T, SIZE>;
 
 	public:
 		static Vector Zero()
@@ -25,19 +28,20 @@ namespace ABMath
 		}
 
 		explicit Vector(const DataType& data)
+			: _data(data)
+		{}
+
+		explicit Vector(std::initializer_list<T> data)
 			: _data()
 		{
-			const size_t inDataSize = data.size();
-			for (size_t i = 0; i < SIZE; ++i)
+			size_t i = 0;
+			for (const T& val : data)
 			{
-				if (i < inDataSize)
-				{
-					_data.push_back(data[i]);
-				}
-				else
+				if (i == SIZE)
 				{
-					_data.push_back(T(0));
+					break;
 				}
+				_data[i++] = val;
 			}
 		}
 
@@ -52,15 +56,20 @@ namespace ABMath
 			return const_cast<T&>(constThis.At(index));
 		}
 
+		const T* GetData() const
+		{
+			return _data.data();
+		}
+
+		T* GetData()
+		{
+			return _data.data();
+		}
+
 	private:
 		Vector()
 			: _data()
-		{
-			for (size_t i = 0; i < SIZE; ++i)
-			{
-				_data.push_back(T(0));
-			}
-		}
+		{}
 
 	private:
 		DataType _data;
@@ -78,6 +87,28 @@ namespace ABMath
 	using IVector3 = IVector<3>;
 	using IVector4 = IVector<4>;
 
+	static_assert(sizeof(FVector3) == 3 * sizeof(float));
+	static_assert(std::is_trivially_copyable_v<FVector3>);
+	static_assert(std::is_nothrow_move_constructible_v<FVector3> && std::is_nothrow_move_assignable_v<FVector3>);
+
+	template<class T, size_t SIZE>
+	constexpr bool IS_SIMD_VECTOR = Simd::IS_ENABLED && std::is_same_v<T, float> && (SIZE == 3 || SIZE == 4);
+
+	namespace Detail
+	{
+		template<size_t SIZE>
+		Simd::Float4 LoadSimd(const Vector<float, SIZE>& vector)
+		{
+			return Simd::Load<SIZE>(vector.GetData());
+		}
+
+		template<size_t SIZE>
+		void StoreSimd(Vector<float, SIZE>& vector, const Simd::Float4 value)
+		{
+			Simd::Store<SIZE>(vector.GetData(), value);
+		}
+	}
+
 	template<class T>
 	Vector<T, 4> ToVector4(const Vector<T, 3>& vector, const T& w)
 	{
@@ -133,6 +164,12 @@ namespace ABMath
 	template<class T, size_t SIZE>
 	void Multiply(Vector<T, SIZE>& vec, const T& val)
 	{
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			Detail::StoreSimd(vec, Simd::Multiply(Detail::LoadSimd(vec), Simd::Splat(val)));
+			return;
+		}
+
 		for (size_t i = 0; i < SIZE; ++i)
 		{
 			vec.At(i) *= val;
@@ -158,6 +195,18 @@ namespace ABMath
 		return Multiply(vec, val);
 	}
 
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> Multiply(Vector<T, SIZE>&& vec, const T& val)
+	{
+		Multiply(vec, val);
+		return std::move(vec);
+	}
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> operator*(Vector<T, SIZE>&& vec, const T& val)
+	{
+		return Multiply(std::move(vec), val);
+	}
+
 	template<class T, size_t SIZE>
 	void Divide(Vector<T, SIZE>& vec, const T& val)
 	{
@@ -180,9 +229,27 @@ namespace ABMath
 		return Divide(vec, val);
 	}
 
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> Divide(Vector<T, SIZE>&& vec, const T& val)
+	{
+		Divide(vec, val);
+		return std::move(vec);
+	}
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> operator/(Vector<T, SIZE>&& vec, const T& val)
+	{
+		return Divide(std::move(vec), val);
+	}
+
 	template<class T, size_t SIZE>
 	void Add(Vector<T, SIZE>& outLeft, const Vector<T, SIZE>& right)
 	{
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			Detail::StoreSimd(outLeft, Simd::Add(Detail::LoadSimd(outLeft), Detail::LoadSimd(right)));
+			return;
+		}
+
 		for (size_t i = 0; i < SIZE; ++i)
 		{
 			outLeft.At(i) += right.At(i);
@@ -208,9 +275,27 @@ namespace ABMath
 		return Add(left, right);
 	}
 
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> Add(Vector<T, SIZE>&& left, const Vector<T, SIZE>& right)
+	{
+		Add(left, right);
+		return std::move(left);
+	}
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> operator+(Vector<T, SIZE>&& left, const Vector<T, SIZE>& right)
+	{
+		return Add(std::move(left), right);
+	}
+
 	template<class T, size_t SIZE>
 	void Subtract(Vector<T, SIZE>& outLeft, const Vector<T, SIZE>& right)
 	{
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			Detail::StoreSimd(outLeft, Simd::Subtract(Detail::LoadSimd(outLeft), Detail::LoadSimd(right)));
+			return;
+		}
+
 		for (size_t i = 0; i < SIZE; ++i)
 		{
 			outLeft.At(i) -= right.At(i);
@@ -236,6 +321,18 @@ namespace ABMath
 		return Subtract(left, right);
 	}
 
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> Subtract(Vector<T, SIZE>&& left, const Vector<T, SIZE>& right)
+	{
+		Subtract(left, right);
+		return std::move(left);
+	}
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> operator-(Vector<T, SIZE>&& left, const Vector<T, SIZE>& right)
+	{
+		return Subtract(std::move(left), right);
+	}
+
 	template<class T, size_t SIZE>
 	Vector<T, SIZE> operator-(const Vector<T, SIZE>& vec)
 	{
@@ -245,6 +342,11 @@ namespace ABMath
 	template<class T, size_t SIZE>
 	float DotProduct(const Vector<T, SIZE>& left, const Vector<T, SIZE>& right)
 	{
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			return Simd::HorizontalSum(Simd::Multiply(Detail::LoadSimd(left), Detail::LoadSimd(right)));
+		}
+
 		float result = 0.f;
 		for (size_t i = 0; i < SIZE; ++i)
 		{
@@ -283,6 +385,11 @@ namespace ABMath
 	template<class T, size_t SIZE>
 	float Length(const Vector<T, SIZE>& vector)
 	{
+		if constexpr (IS_SIMD_VECTOR<T, SIZE>)
+		{
+			return std::sqrt(DotProduct(vector, vector));
+		}
+
 		float length = 0;
 		for (size_t i = 0; i < SIZE; ++i)
 		{
@@ -307,5 +414,12 @@ namespace ABMath
 
 		return Divide(vector, T(length));
 	}
+
+	template<class T, size_t SIZE>
+	Vector<T, SIZE> CreateNormalized(Vector<T, SIZE>&& vector)
+	{
+		Normalize(vector);
+		return std::move(vector);
+	}
 }
 
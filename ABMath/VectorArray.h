@@ -0,0 +1,290 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "Vector.h"
+
+namespace ABMath
+{
+	// Structure-of-arrays storage for many vectors: component i of every vector lives in lane i.
+	template<class T, size_t SIZE>
+	class VectorArray
+	{
+	public:
+		using LaneType = std::vector<T>;
+
+	public:
+		VectorArray() = default;
+
+		explicit VectorArray(const size_t size)
+		{
+			Resize(size);
+		}
+
+		size_t GetSize() const
+		{
+			return _lanes[0].size();
+		}
+
+		void Resize(const size_t size)
+		{
+			for (auto& lane : _lanes)
+			{
+				lane.resize(size, T(0));
+			}
+		}
+
+		void Reserve(const size_t capacity)
+		{
+			for (auto& lane : _lanes)
+			{
+				lane.reserve(capacity);
+			}
+		}
+
+		void PushBack(const Vector<T, SIZE>& vector)
+		{
+			for (size_t component = 0; component < SIZE; ++component)
+			{
+				_lanes[component].push_back(vector.At(component));
+			}
+		}
+
+		Vector<T, SIZE> Get(const size_t index) const
+		{
+			auto data = typename Vector<T, SIZE>::DataType();
+			for (size_t component = 0; component < SIZE; ++component)
+			{
+				data[component] = _lanes[component][index];
+			}
+
+			return Vector<T, SIZE>(data);
+		}
+
+		void Set(const size_t index, const Vector<T, SIZE>& vector)
+		{
+			for (size_t component = 0; component < SIZE; ++component)
+			{
+				_lanes[component][index] = vector.At(component);
+			}
+		}
+
+		const T& At(const size_t index, const size_t component) const
+		{
+			return _lanes[component][index];
+		}
+
+		T& At(const size_t index, const size_t component)
+		{
+			const auto& constThis = static_cast<const VectorArray&>(*this);
+			return const_cast<T&>(constThis.At(index, component));
+		}
+
+		const T* GetLane(const size_t component) const
+		{
+			return _lanes[component].data();
+		}
+
+		T* GetLane(const size_t component)
+		{
+			return _lanes[component].data();
+		}
+
+	private:
+		std::array<LaneType, SIZE> _lanes;
+	};
+
+	template<size_t SIZE>
+	using FVectorArray = VectorArray<float, SIZE>;
+	using FVectorArray2 = FVectorArray<2>;
+	using FVectorArray3 = FVectorArray<3>;
+	using FVectorArray4 = FVectorArray<4>;
+
+	template<size_t SIZE>
+	using IVectorArray = VectorArray<int, SIZE>;
+	using IVectorArray2 = IVectorArray<2>;
+	using IVectorArray3 = IVectorArray<3>;
+	using IVectorArray4 = IVectorArray<4>;
+
+	template<class T, size_t SIZE>
+	void Multiply(VectorArray<T, SIZE>& vectors, const T& val)
+	{
+		const size_t size = vectors.GetSize();
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			T* lane = vectors.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				lane[i] *= val;
+			}
+		}
+	}
+
+	template<class T, size_t SIZE>
+	VectorArray<T, SIZE> Multiply(const VectorArray<T, SIZE>& vectors, const T& val)
+	{
+		auto result = vectors;
+		Multiply(result, val);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	void Add(VectorArray<T, SIZE>& outLeft, const VectorArray<T, SIZE>& right)
+	{
+		assert(outLeft.GetSize() == right.GetSize());
+
+		const size_t size = outLeft.GetSize();
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			T* leftLane = outLeft.GetLane(component);
+			const T* rightLane = right.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				leftLane[i] += rightLane[i];
+			}
+		}
+	}
+
+	template<class T, size_t SIZE>
+	VectorArray<T, SIZE> Add(const VectorArray<T, SIZE>& left, const VectorArray<T, SIZE>& right)
+	{
+		auto result = left;
+		Add(result, right);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	void Subtract(VectorArray<T, SIZE>& outLeft, const VectorArray<T, SIZE>& right)
+	{
+		assert(outLeft.GetSize() == right.GetSize());
+
+		const size_t size = outLeft.GetSize();
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			T* leftLane = outLeft.GetLane(component);
+			const T* rightLane = right.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				leftLane[i] -= rightLane[i];
+			}
+		}
+	}
+
+	template<class T, size_t SIZE>
+	VectorArray<T, SIZE> Subtract(const VectorArray<T, SIZE>& left, const VectorArray<T, SIZE>& right)
+	{
+		auto result = left;
+		Subtract(result, right);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	void DotProduct(const VectorArray<T, SIZE>& left, const VectorArray<T, SIZE>& right, std::vector<float>& outResult)
+	{
+		assert(left.GetSize() == right.GetSize());
+
+		const size_t size = left.GetSize();
+		outResult.assign(size, 0.f);
+
+		float* result = outResult.data();
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			const T* leftLane = left.GetLane(component);
+			const T* rightLane = right.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				result[i] += leftLane[i] * rightLane[i];
+			}
+		}
+	}
+
+	template<class T, size_t SIZE>
+	std::vector<float> DotProduct(const VectorArray<T, SIZE>& left, const VectorArray<T, SIZE>& right)
+	{
+		auto result = std::vector<float>();
+		DotProduct(left, right, result);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	void Length(const VectorArray<T, SIZE>& vectors, std::vector<float>& outResult)
+	{
+		DotProduct(vectors, vectors, outResult);
+		for (float& length : outResult)
+		{
+			length = std::sqrt(length);
+		}
+	}
+
+	template<class T, size_t SIZE>
+	std::vector<float> Length(const VectorArray<T, SIZE>& vectors)
+	{
+		auto result = std::vector<float>();
+		Length(vectors, result);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	void Normalize(VectorArray<T, SIZE>& vectors)
+	{
+		auto scales = Length(vectors);
+		for (float& scale : scales)
+		{
+			scale = float(T(1) / T(scale));
+		}
+
+		const size_t size = vectors.GetSize();
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			T* lane = vectors.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				lane[i] *= T(scales[i]);
+			}
+		}
+	}
+
+	template<class T, size_t SIZE>
+	VectorArray<T, SIZE> CreateNormalized(const VectorArray<T, SIZE>& vectors)
+	{
+		auto result = vectors;
+		Normalize(result);
+
+		return result;
+	}
+
+	template<class T, size_t SIZE>
+	VectorArray<T, SIZE> CrossProduct(const VectorArray<T, SIZE>& left, const VectorArray<T, SIZE>& right)
+	{
+		assert(left.GetSize() == right.GetSize());
+
+		const size_t size = left.GetSize();
+		auto result = VectorArray<T, SIZE>(size);
+
+		for (size_t component = 0; component < SIZE; ++component)
+		{
+			const size_t index1 = (component + 1) % SIZE;
+			const size_t index2 = (component + 2) % SIZE;
+
+			const T* left1 = left.GetLane(index1);
+			const T* left2 = left.GetLane(index2);
+			const T* right1 = right.GetLane(index1);
+			const T* right2 = right.GetLane(index2);
+			T* resultLane = result.GetLane(component);
+			for (size_t i = 0; i < size; ++i)
+			{
+				resultLane[i] = left1[i] * right2[i] - left2[i] * right1[i];
+			}
+		}
+
+		return result;
+	}
+}